@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#ifndef RMP_EVAL_CHECKPOINTWRITER_H
+#define RMP_EVAL_CHECKPOINTWRITER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "reporter.h"
+
+namespace Evaluator
+{
+  // Periodic on-disk snapshot of every report row (--checkpoint), so a power
+  // blip at hour 60 of a 72-hour soak does not destroy the run. A non-RT
+  // thread reads each row through the ReportSlot seqlock — never touching RT
+  // timing — writes the whole state to <path>.tmp, fsyncs, and atomically
+  // renames it over <path>, so a torn checkpoint can never exist on disk.
+  // The file is a header plus one fixed-size row per stream, a few KB total,
+  // cheap enough to rewrite every few seconds. Version covers the ReportData
+  // layout and is bumped whenever either struct changes.
+  class CheckpointWriter
+  {
+  public:
+    static constexpr uint32_t FileVersion = 1;
+    static constexpr size_t MaxLabelSize = 32;
+
+    struct Header
+    {
+      char Magic[8]; // "RMPEVCP\0"
+      uint32_t Version;
+      uint32_t RowCount;
+      uint64_t PeriodNanoseconds;
+      uint64_t ElapsedNanoseconds;
+    };
+
+    struct Row
+    {
+      char Label[MaxLabelSize]; // NUL-terminated, truncated if longer
+      ReportData Data;
+    };
+
+    // startTime must already be shifted backwards by a resumed checkpoint's
+    // elapsed time, so ElapsedNanoseconds keeps accumulating across restarts.
+    CheckpointWriter(const std::string& argPath,
+      const std::vector<std::pair<std::string_view, ReportSlot*>>& argRows,
+      uint64_t argPeriodNanoseconds, std::chrono::seconds argInterval,
+      std::chrono::steady_clock::time_point argStartTime);
+    ~CheckpointWriter();
+
+  private:
+    void WriterThread();
+    bool WriteCheckpoint();
+
+    std::string path;
+    std::vector<std::pair<std::string, ReportSlot*>> rows;
+    uint64_t periodNanoseconds = 0;
+    std::chrono::seconds interval;
+    std::chrono::steady_clock::time_point startTime;
+    bool warned = false;
+    std::atomic_bool running{true};
+    std::thread writer;
+  };
+
+  // Parsed contents of a checkpoint file, used by --resume to seed the
+  // TimerReports before the RT loops start.
+  struct CheckpointState
+  {
+    uint64_t PeriodNanoseconds = 0;
+    uint64_t ElapsedNanoseconds = 0;
+    std::vector<std::pair<std::string, ReportData>> Rows;
+
+    // The row with the given label, or nullptr when the checkpoint has none.
+    const ReportData* Find(std::string_view label) const;
+  };
+
+  // Throws on a missing, truncated, or layout-incompatible file.
+  CheckpointState LoadCheckpoint(const std::string& path);
+} // end namespace Evaluator
+
+#endif // !defined(RMP_EVAL_CHECKPOINTWRITER_H)
@@ -16,7 +16,10 @@ namespace Evaluator
   // Command line parsing based off of Simon Schneegans' command line parsing class
   //    http://schneegans.github.io/tutorials/2019/08/06/commandline
   
-  using ParsedValue = std::variant<uint16_t*, int32_t*, uint32_t*, double*, float*, bool*, std::string*, uint64_t*>;
+  // Vector alternatives make an argument repeatable: each occurrence on the
+  // command line appends a value instead of tripping the duplicate check.
+  using ParsedValue = std::variant<uint16_t*, int32_t*, uint32_t*, double*, float*, bool*, std::string*, uint64_t*,
+    std::vector<std::string>*, std::vector<int32_t>*>;
 
   struct Argument
   {
@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace Evaluator
 {
@@ -45,6 +46,7 @@ namespace Evaluator
     ClocksourceStable,
     SmtSiblingIsolated,
     TimerMigration,
+    NicNumaLocal,
   };
   
   enum class Status
@@ -95,7 +97,21 @@ namespace Evaluator
   std::string GetCpuInfo();
   std::string GetKernelInfo();
 
-  void ReportSystemConfiguration(int cpu, std::string_view nicName = DefaultNicName);
+  // Isolated cores (from /sys/devices/system/cpu/isolated, falling back to
+  // the isolcpus= boot parameter), sorted ascending; empty when none are
+  // isolated. Used by --smp to place one cyclic thread per isolated core.
+  std::vector<int> GetIsolatedCpus();
+
+  // NUMA topology: the node owning the NIC's PCIe root complex (-1 when the
+  // sysfs attribute is absent or the host is not NUMA), and the CPUs of a
+  // given node, sorted ascending (empty when the node does not exist). Used
+  // to default the RT cores onto the NIC-local node on multi-socket hosts.
+  int GetNicNumaNode(std::string_view nicName);
+  std::vector<int> GetNodeCpus(int node);
+
+  // Prints the configuration report to stdout and returns every check result
+  // so callers can serialize them (e.g. into --output files).
+  std::vector<CheckResult> ReportSystemConfiguration(int cpu, std::string_view nicName = DefaultNicName);
 }
 
 
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#ifndef RMP_EVAL_LOADGENERATOR_H
+#define RMP_EVAL_LOADGENERATOR_H
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Evaluator
+{
+  // Parsed form of the --load specification ("cpu:N,mem:M,io:K", any subset,
+  // any order). The worker kernels are fixed and versioned, so a description
+  // string fully determines the pressure applied and two runs with the same
+  // string are comparable across machines and dates.
+  struct LoadSpec
+  {
+    int CpuWorkers = 0;
+    int MemWorkers = 0;
+    int IoWorkers = 0;
+
+    // Parse the --load text. Throws when a token is malformed or the
+    // specification asks for no workers at all.
+    static LoadSpec Parse(const std::string& text);
+
+    // Canonical "cpu:N,mem:M,io:K (load v1)" form, embedded in the report
+    // and the --output file so archived results carry their load conditions.
+    [[nodiscard]] std::string Describe() const;
+  };
+
+  // In-process background load (--load). Production machines run RMP next to
+  // vision, logging and HMI processes; an idle-system latency table is the
+  // best case, and a hand-run stress-ng next to the evaluator is not
+  // reproducible across labs. The generator spawns plain SCHED_OTHER worker
+  // threads, each pinned away from the reserved RT cores, running fixed
+  // kernels: integer spin (cpu), streaming passes over a buffer far larger
+  // than LLC (mem), and write/fsync loops on an unlinked temp file (io).
+  // Workers start in the constructor and stop when it is destroyed.
+  class LoadGenerator
+  {
+  public:
+    LoadGenerator(const LoadSpec& argSpec, const std::vector<int>& argReservedCores);
+    ~LoadGenerator();
+
+    LoadGenerator(const LoadGenerator&) = delete;
+    LoadGenerator& operator=(const LoadGenerator&) = delete;
+
+    [[nodiscard]] const std::string& Description() const
+    {
+      return description;
+    }
+
+  private:
+    void CpuWorker(int cpuCore);
+    void MemWorker(int cpuCore);
+    void IoWorker(int cpuCore, int workerIndex);
+
+    std::string description;
+    std::atomic_bool running{true};
+    std::vector<std::thread> workers;
+  };
+} // end namespace Evaluator
+
+#endif // !defined(RMP_EVAL_LOADGENERATOR_H)
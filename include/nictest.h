@@ -6,13 +6,19 @@
 #ifndef RMP_EVAL_NICTEST_H
 #define RMP_EVAL_NICTEST_H
 
-#include <condition_variable>
+#include <array>
+#include <atomic>
 #include <cstdint>
-#include <mutex>
+#include <memory>
 #include <string>
 #include <limits>
+#include <sys/socket.h>
+#include <vector>
 
+#include "outliertracer.h"
+#include "perfcounters.h"
 #include "reporter.h"
+#include "samplerecorder.h"
 
 namespace Evaluator
 {
@@ -54,34 +60,138 @@ namespace Evaluator
   {
     RunningStats HardwareDeltaNanoseconds; // inter-arrival using hardware timestamps
     RunningStats SoftwareDeltaNanoseconds; // inter-arrival using software timestamps
+    RunningStats BurstHardwareSpreadNanoseconds; // last-minus-first HW timestamp within one burst (--burst > 1)
   };
 
   struct TestParameters
   {
     std::string NicName;
+    std::string Backend = "raw"; // "raw" (PF_PACKET), "ring" (PACKET_MMAP), or "xdp" (AF_XDP)
     uint64_t Iterations = 0;
     int SendSleep = 0;
     int SendPriority = 0;
     int ReceivePriority = 0;
     int SendCpu = 0;
     int ReceiveCpu = 0;
-    ReportData* SendData = nullptr;
-    ReportData* ReceiveData = nullptr;
+    ReportSlot* SendData = nullptr;
+    ReportSlot* ReceiveData = nullptr;
+    // One-way TX-to-RX hardware latency (wire plus device turnaround),
+    // populated by the raw backend from the MSG_ERRQUEUE TX timestamps.
+    ReportSlot* WireData = nullptr;
+    // Sender cycle decomposition (wired under --verbose): wakeup latency
+    // (actual wake minus the absolute clock_nanosleep deadline) and work
+    // duration (wake to post-Send timestamp), so a late cycle can be blamed
+    // on the scheduler or the NIC driver respectively.
+    ReportSlot* WakeupData = nullptr;
+    ReportSlot* WorkData = nullptr;
+    // Checkpoint baselines (--resume): when set, the send/receive
+    // TimerReports are seeded with these cumulative counters before the RT
+    // loops start, so a resumed soak keeps accumulating where it left off.
+    const ReportData* SendBaseline = nullptr;
+    const ReportData* ReceiveBaseline = nullptr;
+    WindowSlots* SendWindows = nullptr;
+    WindowSlots* ReceiveWindows = nullptr;
+    Histogram* SendHistogram = nullptr;
+    Histogram* ReceiveHistogram = nullptr;
+    SampleRecorder* Recorder = nullptr;
+    OutlierTracer* Outliers = nullptr;
+    PerfCounters* SendPerf = nullptr;
+    PerfCounters* ReceivePerf = nullptr;
     bool IsVerbose = false;
     uint64_t BucketWidth = 0;
+    int Datagrams = 1; // BRD sub-datagrams per probe frame
+    // Frames per cycle (raw backend): >1 moves the whole burst with one
+    // sendmmsg/recvmmsg each way to measure throughput headroom, tracking the
+    // hardware-timestamp spread within each burst.
+    int Burst = 1;
+    bool BusyPoll = false; // spin on the receive socket instead of sleeping in poll()
+    bool Percentiles = false; // track p99/p99.9/p99.99 and show them as columns
+    // Run the sender under SCHED_DEADLINE (EDF) instead of SCHED_FIFO, with
+    // runtime/deadline/period derived from SendSleep and overruns counted via
+    // SCHED_FLAG_DL_OVERRUN.
+    bool DeadlineSched = false;
   };
 
+  // Pause the CPU briefly inside a spin-wait loop without yielding to the
+  // kernel, so SCHED_FIFO spinners stay polite to the hyperthread sibling.
+  inline void CpuRelax()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#else
+    asm volatile("" ::: "memory");
+#endif
+  }
+
+  // EtherCAT probe frame layout, shared by all backends. A frame is the
+  // 14-byte Ethernet header, the 2-byte EtherCAT header, then one or more
+  // 13-byte BRD sub-datagrams (10-byte header, 1 data byte, 2-byte working
+  // counter). With the maximum sub-datagram count the frame reaches the
+  // 1500-byte Ethernet payload limit, which lets us measure wire time and NIC
+  // DMA latency at realistic process-data sizes instead of only the minimal
+  // 29-byte probe.
+  inline constexpr size_t EthernetHeaderSize = 14;
+  inline constexpr size_t EthercatHeaderSize = 2;
+  inline constexpr size_t DatagramHeaderSize = 10;
+  inline constexpr size_t DatagramDataSize = 1;
+  inline constexpr size_t WorkingCounterSize = 2;
+  inline constexpr size_t DatagramSize = DatagramHeaderSize + DatagramDataSize + WorkingCounterSize;
+  inline constexpr int MaxDatagrams = 115; // keeps the EtherCAT payload within 1500 bytes
+  inline constexpr int MaxBurst = 64; // frames per cycle under --burst; bounds the preallocated message arrays
+  inline constexpr size_t MaxFrameSize = EthernetHeaderSize + EthercatHeaderSize
+    + static_cast<size_t>(MaxDatagrams) * DatagramSize;
+
+  // Assemble a probe frame with the requested sub-datagram count into the
+  // buffer (which must hold MaxFrameSize bytes); returns the frame length.
+  // Called once at backend construction, never on the RT path.
+  size_t BuildProbeFrame(unsigned char* buffer, int datagramCount);
+
+  // Spin (bounded, userspace only) until counter is strictly greater than
+  // value. Returns false if timeout elapses first. The deadline clock is only
+  // consulted every few hundred spins so the fast path stays a compare plus a
+  // pause.
+  inline bool SpinWaitAbove(const std::atomic<uint64_t>& counter, uint64_t value, std::chrono::nanoseconds timeout)
+  {
+    static constexpr int SpinsPerDeadlineCheck = 512;
+    const uint64_t deadline = GetCurrentTime() + static_cast<uint64_t>(timeout.count());
+    int spins = 0;
+    while (counter.load(std::memory_order_acquire) <= value)
+    {
+      CpuRelax();
+      if (++spins >= SpinsPerDeadlineCheck)
+      {
+        spins = 0;
+        if (GetCurrentTime() >= deadline)
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
   class EthercatNicTest : public INicTest
   {
     int socketDescriptor;
-    std::mutex mutex;
-    std::condition_variable condition;
+    // Probe frame assembled once at construction; Send() only transmits it.
+    std::array<unsigned char, MaxFrameSize> frameBuffer = {};
+    size_t frameLength = 0;
     CadenceStats stats;
-    uint64_t sendIteration = 0;
-    uint64_t receiveIteration = 0;
+    // Lock-free rendezvous between the sender and receiver RT threads: the
+    // receiver bumps receiveIteration when it is parked on the socket and the
+    // sender spins (bounded) until the receiver is ahead. No mutex, no futex,
+    // so neither SCHED_FIFO thread enters the kernel to synchronize.
+    std::atomic<uint64_t> sendIteration{0};
+    std::atomic<uint64_t> receiveIteration{0};
     TestParameters params;
     TimerReport hardwareReport;
     TimerReport softwareReport;
+    // One-way latency from the TX hardware timestamp (drained from the error
+    // queue) to the RX hardware timestamp of the same cycle. Target 0: the
+    // observation is an absolute latency, not a deviation from a period.
+    TimerReport wireReport;
 
     struct PrevStats
     {
@@ -91,6 +201,20 @@ namespace Evaluator
       bool HaveSoftware = false;
     } prev;
 
+    // Burst mode (params.Burst > 1): message headers, iovecs, and receive
+    // buffers prepared once at construction so Send()/Receive() move the
+    // whole burst with a single sendmmsg/recvmmsg call and no per-cycle
+    // setup. Preallocated before the RT threads start, so mlockall covers them.
+    std::vector<mmsghdr> sendMessages;
+    std::vector<iovec> sendVectors;
+    std::vector<mmsghdr> receiveMessages;
+    std::vector<iovec> receiveVectors;
+    std::vector<std::array<char, 2048>> receiveBuffers;
+    std::vector<std::array<char, 512>> receiveControls;
+
+    void DrainTxTimestamps(int64_t rxHardwareNanoseconds);
+    bool ReceiveBurst();
+
     static constexpr std::chrono::seconds SocketTimeout{1};
   public:
     EthercatNicTest(const TestParameters& argParams, TimerReport&& hardwareReport, TimerReport&& softwareReport);
@@ -99,6 +223,98 @@ namespace Evaluator
     bool Receive() override;
   };
 
+  // PACKET_MMAP backend: the PF_PACKET socket is upgraded to memory-mapped
+  // TX/RX rings so Send() becomes a status-flag flip in a shared slot plus a
+  // zero-byte kick, and Receive() reads the frame and its kernel timestamp
+  // straight from the ring slot header instead of a recvmsg() cmsg walk.
+  // TPACKET_V2 is used for both rings: V3 only wakes the reader when a whole
+  // block retires (>= 1 ms timeout granularity), which would add up to a full
+  // block timeout of latency per frame; V2 flips per-frame status words.
+  class PacketRingNicTest : public INicTest
+  {
+    int socketDescriptor = -1;
+    void* ringMap = nullptr;
+    size_t ringMapLength = 0;
+    unsigned char* rxRing = nullptr;
+    unsigned char* txRing = nullptr;
+    // Probe frame assembled once at construction; Send() copies it into the slot.
+    std::array<unsigned char, MaxFrameSize> frameBuffer = {};
+    size_t frameLength = 0;
+    uint32_t frameCount = 0;
+    uint32_t rxIndex = 0;
+    uint32_t txIndex = 0;
+    CadenceStats stats;
+    std::atomic<uint64_t> sendIteration{0};
+    std::atomic<uint64_t> receiveIteration{0};
+    TestParameters params;
+    TimerReport hardwareReport;
+    TimerReport softwareReport;
+
+    struct PrevStats
+    {
+      int64_t HardwareNanoseconds = 0;
+      int64_t SoftwareNanoseconds = 0;
+      bool HaveHardware = false;
+      bool HaveSoftware = false;
+    } prev;
+
+    static constexpr std::chrono::seconds SocketTimeout{1};
+  public:
+    PacketRingNicTest(const TestParameters& argParams, TimerReport&& hardwareReport, TimerReport&& softwareReport);
+    ~PacketRingNicTest() override;
+    void Send() override;
+    bool Receive() override;
+  };
+
+  // AF_XDP backend: frames move between the NIC ring and a preallocated,
+  // mlocked UMEM without traversing the kernel network stack. The socket is
+  // bound zero-copy when the driver supports it (falling back to copy mode),
+  // and a minimal XDP redirect program is loaded via raw bpf(2) syscalls so we
+  // carry no libbpf/libxdp dependency. Per-packet hardware timestamps are not
+  // available on this path, so the HW/SW delta reports stay empty.
+  class XdpNicTest : public INicTest
+  {
+    // View over one of the four mapped AF_XDP rings. The producer/consumer
+    // indices live in kernel-shared memory and are accessed via atomic_ref.
+    struct RingView
+    {
+      uint32_t* producer = nullptr;
+      uint32_t* consumer = nullptr;
+      uint32_t* flags = nullptr;
+      void* descriptors = nullptr;
+      uint32_t size = 0;
+      void* map = nullptr;
+      size_t mapLength = 0;
+    };
+
+    int socketDescriptor = -1;
+    int mapDescriptor = -1;
+    int programDescriptor = -1;
+    int linkDescriptor = -1;
+    void* umem = nullptr;
+    size_t umemLength = 0;
+    size_t frameLength = 0; // probe frame prebuilt into every TX UMEM slot
+    RingView fillRing, completionRing, rxRing, txRing;
+    uint32_t nextTxFrame = 0;
+    uint32_t outstandingTx = 0;
+    std::atomic<uint64_t> sendIteration{0};
+    std::atomic<uint64_t> receiveIteration{0};
+    TestParameters params;
+
+    void DrainCompletions();
+
+    static constexpr std::chrono::seconds SocketTimeout{1};
+  public:
+    explicit XdpNicTest(const TestParameters& argParams);
+    ~XdpNicTest() override;
+    void Send() override;
+    bool Receive() override;
+  };
+
+  // Construct the INicTest implementation selected by params.Backend.
+  std::shared_ptr<INicTest> CreateNicTest(const TestParameters& params,
+    TimerReport&& hardwareReport, TimerReport&& softwareReport);
+
   std::string AppendErrorCode(const std::string_view message);
 }
 
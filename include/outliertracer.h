@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#ifndef RMP_EVAL_OUTLIERTRACER_H
+#define RMP_EVAL_OUTLIERTRACER_H
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "samplerecorder.h"
+
+namespace Evaluator
+{
+  // Automatic forensics for latency outliers. The RT threads post any cycle
+  // beyond the threshold to a lock-free SPSC mailbox (one compare plus one
+  // slot write); a non-RT helper thread then writes a trace marker (so a
+  // concurrently running trace-cmd capture gets a cursor at the event),
+  // optionally freezes the ftrace ring via tracing_on, and appends the event
+  // with a /proc/interrupts snapshot to an outlier log. All file I/O happens
+  // on the helper thread, off the isolated cores.
+  class OutlierTracer
+  {
+  public:
+    OutlierTracer(const std::string& argLogPath, uint64_t argThresholdNanoseconds, bool argFreezeTracing);
+    ~OutlierTracer();
+
+    // RT side: one compare, plus one slot write and release store on breach.
+    void NoteSend(uint64_t index, uint64_t observation)
+    {
+      if (observation >= threshold) { sendRing.Push(index, observation); }
+    }
+    void NoteReceive(uint64_t index, uint64_t observation)
+    {
+      if (observation >= threshold) { receiveRing.Push(index, observation); }
+    }
+
+  private:
+    void DrainThread();
+    size_t DrainRing(SampleRing& ring, const char* stream);
+    void LogOutlier(const char* stream, const SampleRing::Sample& sample);
+
+    // Outliers should be rare by definition; a small ring still absorbs a
+    // pathological burst without stalling the cycle (excess is dropped and
+    // counted, like the sample recorder).
+    static constexpr size_t RingCapacity = 1 << 10;
+    // Full /proc/interrupts dumps per run; later outliers get a log line only
+    // so a misconfigured threshold cannot fill the disk.
+    static constexpr size_t SnapshotLimit = 16;
+
+    const std::string logPath;
+    const uint64_t threshold;
+    const bool freezeTracing;
+    SampleRing sendRing;
+    SampleRing receiveRing;
+    std::ofstream log;
+    std::string tracingRoot; // /sys/kernel/tracing or the debugfs fallback
+    int markerDescriptor = -1;
+    uint64_t snapshots = 0;
+    uint64_t outliers = 0;
+    bool frozen = false;
+    std::atomic_bool draining{true};
+    std::thread drainer;
+  };
+} // end namespace Evaluator
+
+#endif // !defined(RMP_EVAL_OUTLIERTRACER_H)
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#ifndef RMP_EVAL_PERFCOUNTERS_H
+#define RMP_EVAL_PERFCOUNTERS_H
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "reporter.h"
+
+namespace Evaluator
+{
+  // Hardware performance-counter instrumentation for one RT thread. Opens a
+  // perf_event_open group (context switches, LLC misses, dTLB misses, and SMI
+  // count where the msr PMU exposes it) that follows the pinned thread, reads
+  // the whole group with one read() per cycle, and attributes each cycle's
+  // counter deltas to the latency bucket the cycle landed in. The end-of-run
+  // report then answers "did the Pathetic cycles coincide with SMIs or with
+  // context switches" without a trace-cmd session. Counters that fail to open
+  // (locked-down perf, missing msr PMU) are reported once and skipped.
+  class PerfCounters
+  {
+  public:
+    PerfCounters(uint64_t argTarget, uint64_t argBucketWidth);
+    ~PerfCounters();
+
+    // Must be called from the RT thread itself, after ConfigureThisThread,
+    // so the counters follow the pinned thread.
+    void Open();
+
+    // One group read() plus delta attribution; called once per cycle with
+    // the cycle's period observation.
+    void RecordCycle(uint64_t observation);
+
+    // Called from the main thread after the RT thread has been joined.
+    void Print(std::ostream& stream, std::string_view label) const;
+
+  private:
+    struct Counter
+    {
+      std::string Name;
+      int Descriptor = -1;
+      uint64_t Previous = 0;
+      // Per latency bucket: cycles with a nonzero delta, and the delta sum.
+      std::array<uint64_t, BucketCount> NonzeroCycles = {};
+      std::array<uint64_t, BucketCount> DeltaSum = {};
+    };
+
+    int OpenCounter(uint32_t type, uint64_t config, const std::string& name);
+
+    uint64_t target = 0;
+    uint64_t bucketWidth = 0;
+    int groupLeader = -1;
+    bool primed = false;
+    std::vector<Counter> counters;
+    std::vector<size_t> groupCounters;      // indices into counters, read via the group leader
+    std::vector<size_t> standaloneCounters; // indices read with their own read()
+    std::array<uint64_t, BucketCount> bucketCycles = {};
+    std::vector<uint64_t> readBuffer;
+  };
+} // end namespace Evaluator
+
+#endif // !defined(RMP_EVAL_PERFCOUNTERS_H)
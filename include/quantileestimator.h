@@ -7,6 +7,8 @@
 #define RMP_EVAL_QUANTILEESTIMATOR_H
 
 #include <array>
+#include <cstddef>
+#include <vector>
 
 namespace Evaluator
 {
@@ -31,7 +33,32 @@ namespace Evaluator
     QuantileEstimator(const double _quantile);
   
     double GetQuantile() const;
-  
+
+    void AddObservation(const double observation);
+  };
+
+  // Extended form of the same P^2 algorithm (section 4 of the paper): tracks
+  // several quantiles at once over one shared marker array of 2k+3 markers,
+  // so k tail percentiles cost a short compare scan plus the usual marker
+  // adjustments per observation instead of k full estimators.
+  class MultiQuantileEstimator
+  {
+  private:
+    int numObservations;
+    int markerCount;
+    std::vector<double> quantiles;
+    std::vector<double> markerHeights, markerPositions, desiredMarkerPositions, desiredMarkerPositionIncrements;
+
+    void AddInitialObservation(const double observation);
+    double Parabolic(const int index, const int increment);
+    double Linear(const int index, const int increment);
+
+  public:
+    explicit MultiQuantileEstimator(std::vector<double> _quantiles);
+
+    // Estimate for the index-th quantile passed to the constructor.
+    double GetQuantile(size_t index) const;
+
     void AddObservation(const double observation);
   };
 } // end namespace Evaluator
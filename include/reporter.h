@@ -6,11 +6,16 @@
 #ifndef RMP_EVAL_TIMER_H
 #define RMP_EVAL_TIMER_H
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <chrono>
 #include <cstdint>
 #include <functional>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <time.h>
 
 #include "quantileestimator.h"
@@ -21,6 +26,22 @@ namespace Evaluator
   inline constexpr uint64_t NanoPerSec = 1e9;
   inline constexpr size_t BucketCount = 5; // 5 buckets
 
+  // Destructive-interference granularity for keeping per-thread write state
+  // on private cache lines. A constant rather than
+  // std::hardware_destructive_interference_size, which GCC warns is
+  // ABI-unstable across tuning flags; 64 bytes is correct for every x86_64
+  // and aarch64 part we deploy on.
+  inline constexpr size_t CacheLineSize = 64;
+
+  // Maps a latency-over-target value into one of the doubling buckets; shared
+  // by the report tables and the perf-counter attribution.
+  inline size_t GetBucketIndex(uint64_t element, uint64_t bucketWidth, size_t bucketCount)
+  {
+    size_t deviations = element / bucketWidth;
+    size_t bucketIndex = std::bit_width(deviations);
+    return std::min(bucketIndex, bucketCount - 1);
+  }
+
   struct BucketColorScheme
   {
     static inline constexpr char boldRed[] = "\033[38;5;196m";
@@ -57,6 +78,14 @@ namespace Evaluator
     int maxIndex = -1;
     uint64_t observations = 0;
     double median = 0;
+    // Tail percentile estimates in nanoseconds, populated only when the
+    // report tracks percentiles (--percentiles).
+    double p99 = 0;
+    double p999 = 0;
+    double p9999 = 0;
+    // SCHED_DEADLINE overruns (SIGXCPU deliveries), populated only under
+    // --sched deadline.
+    uint64_t deadlineMisses = 0;
     uint64_t target = 0;
 
     // The "base bucket width". Bucket widths don't scale linearly
@@ -70,6 +99,121 @@ namespace Evaluator
     uint64_t buckets[BucketCount] = {};
   };
 
+  // Single-writer publication slot for live ReportData, protected by a
+  // sequence counter (seqlock). The RT writer publishes with plain stores and
+  // two counter bumps, so it stays wait-free; the reporter thread retries its
+  // copy until it observes an even, unchanged sequence, guaranteeing it never
+  // renders a torn snapshot (e.g. bucket counts exceeding observations).
+  // Cache-line aligned (which also pads the size to a line multiple) so
+  // adjacent slots — the sender's and receiver's, pinned to different cores
+  // and both publishing every cycle — never ping-pong a shared line between
+  // L1s.
+  class alignas(CacheLineSize) ReportSlot
+  {
+  public:
+    // Writer side: called only from the owning RT thread.
+    void Publish(const ReportData& data)
+    {
+      const uint64_t start = sequence.load(std::memory_order_relaxed);
+      sequence.store(start + 1, std::memory_order_relaxed); // odd: write in progress
+      std::atomic_thread_fence(std::memory_order_release);
+      payload = data;
+      std::atomic_thread_fence(std::memory_order_release);
+      sequence.store(start + 2, std::memory_order_release);
+    }
+
+    // Reader side: loops until a consistent snapshot is observed.
+    ReportData Read() const
+    {
+      ReportData copy;
+      for (;;)
+      {
+        const uint64_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1)
+        {
+          continue; // writer mid-update
+        }
+        copy = payload;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before)
+        {
+          return copy;
+        }
+      }
+    }
+
+  private:
+    std::atomic<uint64_t> sequence{0};
+    ReportData payload;
+  };
+
+  // Log-linear high-dynamic-range histogram kept alongside the 5-bucket
+  // summary. Values below SubBucketCount get exact slots; above that each
+  // power of two is split into 32 sub-buckets (~3% relative resolution), so a
+  // lone 900 us spike and a fat tail at 300 us are distinguishable after the
+  // fact. The array is a fixed ~15 KB, allocated before the RT loop starts
+  // (and so covered by the mlockall in main), and Record is a wait-free
+  // shift-and-increment suitable for the RT path.
+  class Histogram
+  {
+  public:
+    static constexpr size_t SubBucketBits = 6;
+    static constexpr size_t SubBucketCount = 1ULL << SubBucketBits; // 64
+    // Enough slots to cover the full 64-bit range; anything past the last
+    // slot saturates there.
+    static constexpr size_t SlotCount = (64 - SubBucketBits + 1) * (SubBucketCount / 2) + (SubBucketCount / 2);
+
+    static size_t SlotIndex(uint64_t value)
+    {
+      if (value < SubBucketCount)
+      {
+        return static_cast<size_t>(value);
+      }
+      const size_t shift = static_cast<size_t>(std::bit_width(value)) - SubBucketBits;
+      const size_t slot = (shift + 1) * (SubBucketCount / 2) + static_cast<size_t>((value >> shift) - SubBucketCount / 2);
+      return std::min(slot, SlotCount - 1);
+    }
+
+    // Smallest value that maps into the given slot.
+    static uint64_t SlotLowerBound(size_t slot)
+    {
+      if (slot < SubBucketCount)
+      {
+        return slot;
+      }
+      const size_t shift = slot / (SubBucketCount / 2) - 1;
+      const uint64_t sub = slot % (SubBucketCount / 2) + SubBucketCount / 2;
+      return sub << shift;
+    }
+
+    void Record(uint64_t value)
+    {
+      ++counts[SlotIndex(value)];
+      ++total;
+    }
+
+    uint64_t TotalObservations() const { return total; }
+    uint64_t Percentile(double percentile) const;
+    void Print(std::ostream& stream, std::string_view label) const;
+
+  private:
+    uint64_t total = 0;
+    uint64_t counts[SlotCount] = {};
+  };
+
+  // Publication slots for rolling-window statistics. Cumulative numbers hide
+  // degradation that starts 40 minutes into a thermal soak, so TimerReport
+  // can additionally aggregate into fixed 6-second sub-windows and publish
+  // merged "last 1m" / "last 10m" views here, plus the first and worst
+  // completed sub-windows for the end-of-run regression callout.
+  struct WindowSlots
+  {
+    ReportSlot OneMinute;
+    ReportSlot TenMinutes;
+    ReportSlot FirstWindow;
+    ReportSlot WorstWindow;
+  };
+
   struct TableColumn
   {
     std::string Label;
@@ -101,12 +245,16 @@ namespace Evaluator
     static constexpr char Dash = '-';
     static constexpr char DashJoint = '+';
     static constexpr int DefaultRowLabelWidth = 8;
-    static TableMaker CreateTableMaker(uint64_t bucketWidth, bool isVerbose = false);
+    static TableMaker CreateTableMaker(uint64_t bucketWidth, bool isVerbose = false, bool withPercentiles = false,
+      bool withDeadlineMisses = false);
     TableMaker();
     void AddColumn(TableColumn&& column);
     void OptimizeColumnWidths();
     void OptimizeColumnWidthsFromData(const std::vector<std::pair<std::string_view, ReportData*>>& reports);
-    void OptimizeRowLabelWidth(const std::vector<std::pair<std::string_view, ReportData*>>& reports);
+    // True when every value still fits its current column, so a renderer can
+    // skip re-optimizing widths until something actually overflows.
+    bool ColumnWidthsFit(const std::vector<std::pair<std::string_view, ReportData*>>& reports) const;
+    void OptimizeRowLabelWidth(const std::vector<std::pair<std::string_view, ReportSlot*>>& reports);
     int GetRowLabelWidth() const { return rowLabelWidth; }
     int PrintLabels(std::ostream& stream) const;
     int PrintRow(std::string_view rowLabel, ReportData& data, std::ostream& stream) const;
@@ -123,9 +271,23 @@ namespace Evaluator
   class TimerReport
   {
   public:
-    TimerReport(uint64_t argTarget, uint64_t argBucketWidth, ReportData* argUpload = nullptr);
+    TimerReport(uint64_t argTarget, uint64_t argBucketWidth, ReportSlot* argUpload = nullptr,
+      Histogram* argHistogram = nullptr, bool argTrackPercentiles = false,
+      WindowSlots* argWindows = nullptr);
     void AddObservation(uint64_t observation, int index);
 
+    // Seed the cumulative counters from a checkpointed snapshot (--resume),
+    // called before the RT loop adds its first observation. The P-squared
+    // estimators cannot be rebuilt from their published quantiles alone, so
+    // median and tail percentiles restart at the resume point; observation
+    // indices restart with the process while the baseline's min/max indices
+    // are kept.
+    void RestoreBaseline(const ReportData& baseline);
+
+    // Under --sched deadline, snapshots read the SIGXCPU overrun count from
+    // here; the counter itself is bumped by the signal handler.
+    void SetDeadlineMissCounter(const std::atomic<uint64_t>* counter) { deadlineMissCounter = counter; }
+
     void PrintReport(bool isVerbose = false, std::ostream& stream = std::cout) const;
 
     ReportData Snapshot() const;
@@ -138,19 +300,98 @@ namespace Evaluator
     int maxIndex = -1;
     uint64_t observations = 0;
     QuantileEstimator median{0.50};
-    ReportData* uploadLocation = nullptr;
+    // One shared-marker estimator for p99/p99.9/p99.99, allocated only when
+    // requested so the default RT path cost is unchanged.
+    std::unique_ptr<MultiQuantileEstimator> tailQuantiles;
+    // Ring of completed 6-second sub-windows plus the one being filled.
+    // Advancing is driven by observation count (period is known), so the hot
+    // path stays clock-free; merging and publishing happen once per advance.
+    struct WindowRing
+    {
+      static constexpr uint64_t SubWindowSeconds = 6;
+      static constexpr size_t SubWindowCount = 100; // last 10 minutes
+      std::array<ReportData, SubWindowCount> windows = {};
+      size_t current = 0;
+      uint64_t remaining = 0;
+      uint64_t perWindow = 0;
+      uint64_t completed = 0;
+      uint64_t worstMax = 0;
+    };
+    std::unique_ptr<WindowRing> ring;
+    WindowSlots* windowSlots = nullptr;
+    const std::atomic<uint64_t>* deadlineMissCounter = nullptr;
+    void AdvanceWindow();
+    ReportData MergeWindows(size_t subWindowCount) const;
+    ReportSlot* uploadLocation = nullptr;
+    Histogram* histogram = nullptr;
     uint64_t target = 0;
     uint64_t bucketWidth = 0;
     uint64_t buckets[BucketCount] = {};
   };
 
+  // Final-summary callout comparing the worst completed sub-window against
+  // the first one, which is what actually exposes thermal-soak degradation
+  // that the cumulative table averages away. Prints nothing if the run was
+  // shorter than one sub-window.
+  void PrintSoakRegression(std::string_view label, WindowSlots& slots, std::ostream& stream = std::cout);
+
   inline uint64_t ToEpoch(const timespec& time)
   {
     return static_cast<uint64_t>(time.tv_sec) * NanoPerSec + static_cast<uint64_t>(time.tv_nsec);
   }
 
+  inline void AddNanoToTimespec(struct timespec* time, const uint64_t nanos)
+  {
+    // Combine both second and nanosecond components into a single time value in nanoseconds
+    // This is to account for rollover when the nanosecond component grows larger than a second
+    // and we must instead increase the second component and reset the nanosecond component.
+    const uint64_t nanoEpoch = ToEpoch(*time) + nanos;
+
+    // Calculate the seconds component by doing integer division (dropping the fractional component)
+    time->tv_sec = nanoEpoch / NanoPerSec;
+
+    // Put the remainder within the nanosecond component.
+    time->tv_nsec = nanoEpoch % NanoPerSec;
+  }
+
+  // Calibrated invariant-TSC fast clock, enabled by --clock tsc. When active,
+  // GetCurrentTime(CLOCK_MONOTONIC) becomes an rdtscp plus a multiply instead
+  // of a clock_gettime call, anchored to CLOCK_MONOTONIC at calibration time
+  // so the two clocks agree. State is written once during startup (before the
+  // RT threads exist) and read-only afterwards.
+  struct TscClockState
+  {
+    static inline std::atomic<bool> Enabled{false};
+    static inline double NanosPerTick = 0.0;
+    static inline uint64_t BaseTicks = 0;
+    static inline uint64_t BaseNanoseconds = 0;
+  };
+
+  inline uint64_t ReadTscOrdered()
+  {
+#if defined(__x86_64__)
+    unsigned int aux = 0;
+    return __builtin_ia32_rdtscp(&aux);
+#else
+    return 0;
+#endif
+  }
+
+  // Verify the kernel clocksource is tsc, calibrate against CLOCK_MONOTONIC,
+  // and report the measured read overhead. Throws if the platform or the
+  // clocksource does not support it.
+  void EnableTscClock(std::ostream& stream = std::cout);
+
+  // Average cost of one GetCurrentTime() call with the currently active clock.
+  double MeasureClockReadOverhead();
+
   inline uint64_t GetCurrentTime(int clockId = CLOCK_MONOTONIC)
   {
+    if (TscClockState::Enabled.load(std::memory_order_relaxed) && clockId == CLOCK_MONOTONIC)
+    {
+      return TscClockState::BaseNanoseconds + static_cast<uint64_t>(
+        static_cast<double>(ReadTscOrdered() - TscClockState::BaseTicks) * TscClockState::NanosPerTick);
+    }
     timespec current;
     clock_gettime(clockId, &current);
     return ToEpoch(current);
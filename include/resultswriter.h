@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#ifndef RMP_EVAL_RESULTSWRITER_H
+#define RMP_EVAL_RESULTSWRITER_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "reporter.h"
+
+namespace Evaluator
+{
+  // Serializes the per-row statistics and the startup configuration check
+  // results to a machine-readable file, JSON or CSV chosen by the file
+  // extension, so the qualification pipeline stops scraping the ANSI table.
+  // Rows are snapshotted through the same seqlock the live table uses, on a
+  // dedicated non-RT thread. With a checkpoint interval the file is rewritten
+  // periodically (write to a temp file, then rename, so readers never see a
+  // partial file) and a crashed multi-day soak still leaves data on disk; the
+  // final write happens at destruction.
+  class ResultsWriter
+  {
+  public:
+    using Row = std::pair<std::string, ReportSlot*>;
+
+    // argLoadDescription is the canonical --load string (empty when the run
+    // was unloaded); it rides along in the file so archived results carry
+    // their load conditions.
+    ResultsWriter(const std::string& argPath, std::vector<Row> argRows,
+      std::vector<CheckResult> argChecks, uint64_t argPeriodNanoseconds,
+      std::chrono::seconds argCheckpointInterval, std::string argLoadDescription = {});
+    ~ResultsWriter();
+
+    // Snapshot every row and rewrite the file. Safe to call while the RT
+    // threads are running.
+    void WriteNow();
+
+  private:
+    void CheckpointThread();
+    void WriteJson(std::ostream& stream, const std::vector<ReportData>& snapshots) const;
+    void WriteCsv(std::ostream& stream, const std::vector<ReportData>& snapshots) const;
+
+    std::string path;
+    bool csv = false;
+    std::vector<Row> rows;
+    std::vector<CheckResult> checks;
+    uint64_t periodNanoseconds = 0;
+    std::chrono::seconds checkpointInterval{0};
+    std::string loadDescription;
+    std::atomic_bool running{true};
+    std::thread checkpointer;
+  };
+} // end namespace Evaluator
+
+#endif // !defined(RMP_EVAL_RESULTSWRITER_H)
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#ifndef RMP_EVAL_SAMPLERECORDER_H
+#define RMP_EVAL_SAMPLERECORDER_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "reporter.h"
+
+namespace Evaluator
+{
+  // Single-producer single-consumer ring for per-cycle samples. The RT writer
+  // publishes with one slot write plus one release store of the head index and
+  // never blocks: if the drainer falls behind, the sample is dropped and
+  // counted rather than stalling the cycle. Capacity is a power of two, and
+  // the slot array is preallocated so the existing mlockall in main covers it.
+  class SampleRing
+  {
+  public:
+    struct Sample
+    {
+      uint64_t Index;
+      uint64_t Observation;
+    };
+
+    explicit SampleRing(size_t argCapacity);
+
+    // RT side.
+    void Push(uint64_t index, uint64_t observation)
+    {
+      const uint64_t currentHead = head.load(std::memory_order_relaxed);
+      if (currentHead - tail.load(std::memory_order_acquire) >= capacity)
+      {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      Sample& slot = slots[currentHead & (capacity - 1)];
+      slot.Index = index;
+      slot.Observation = observation;
+      head.store(currentHead + 1, std::memory_order_release);
+    }
+
+    // Drainer side: pops up to maxSamples into the output array, returns count.
+    size_t Pop(Sample* output, size_t maxSamples);
+
+    uint64_t DroppedSamples() const { return dropped.load(std::memory_order_relaxed); }
+
+  private:
+    const size_t capacity;
+    std::unique_ptr<Sample[]> slots;
+    // Head (RT producer) and tail (drainer consumer) live on separate cache
+    // lines; on one line every Push would ping-pong it between the isolated
+    // core and the housekeeping core.
+    alignas(CacheLineSize) std::atomic<uint64_t> head{0};
+    alignas(CacheLineSize) std::atomic<uint64_t> tail{0};
+    std::atomic<uint64_t> dropped{0};
+  };
+
+  // Streams every cycle's (index, observation) pair to a compact binary file
+  // via a non-RT drainer thread, so multi-hour soaks can be correlated against
+  // trace-cmd captures offline. File layout: RecordFileHeader followed by
+  // RecordEntry structs in arrival order.
+  class SampleRecorder
+  {
+  public:
+    struct RecordFileHeader
+    {
+      char Magic[8]; // "RMPEVAL\0"
+      uint32_t Version;
+      uint32_t ClockId;
+      uint64_t PeriodNanoseconds;
+    };
+
+    struct RecordEntry
+    {
+      uint32_t Stream; // 0 = sender, 1 = receiver
+      uint32_t Reserved;
+      uint64_t Index;
+      uint64_t Observation;
+    };
+
+    static constexpr uint32_t FileVersion = 1;
+    static constexpr uint32_t SenderStream = 0;
+    static constexpr uint32_t ReceiverStream = 1;
+
+    SampleRecorder(const std::string& path, uint64_t periodNanoseconds, int clockId);
+    ~SampleRecorder();
+
+    // RT side: one slot write plus one release store each.
+    void RecordSend(uint64_t index, uint64_t observation) { sendRing.Push(index, observation); }
+    void RecordReceive(uint64_t index, uint64_t observation) { receiveRing.Push(index, observation); }
+
+  private:
+    void DrainThread();
+    size_t DrainRing(SampleRing& ring, uint32_t stream);
+
+    static constexpr size_t RingCapacity = 1 << 16; // power of two, ~1MB per ring
+    static constexpr size_t DrainBatchSize = 1024;
+
+    SampleRing sendRing;
+    SampleRing receiveRing;
+    std::FILE* file = nullptr;
+    std::atomic_bool draining{true};
+    std::thread drainer;
+  };
+} // end namespace Evaluator
+
+#endif // !defined(RMP_EVAL_SAMPLERECORDER_H)
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#ifndef RMP_EVAL_STATSSEGMENT_H
+#define RMP_EVAL_STATSSEGMENT_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "reporter.h"
+
+namespace Evaluator
+{
+  // Live-stats export for external dashboards: the report rows are mirrored
+  // into a named shared-memory file (/dev/shm/rmp-eval) so readers can observe
+  // the run with zero extra load on the isolated cores and without parsing
+  // ANSI output. Each row is guarded by the same seqlock discipline as the
+  // in-process ReportSlot: readers copy the row, then retry until the
+  // sequence word is even and unchanged. Layout is Header followed by
+  // Header.RowCount Row structs; Version covers the ReportData layout and is
+  // bumped whenever either struct changes.
+  class StatsSegment
+  {
+  public:
+    static constexpr uint32_t LayoutVersion = 1;
+    static constexpr size_t MaxLabelSize = 32;
+
+    struct Header
+    {
+      char Magic[8]; // "RMPEVAL\0"
+      uint32_t Version;
+      uint32_t RowCount;
+      uint64_t PeriodNanoseconds;
+    };
+
+    struct Row
+    {
+      char Label[MaxLabelSize]; // NUL-terminated, truncated if longer
+      std::atomic<uint64_t> Sequence;
+      ReportData Data;
+    };
+
+    StatsSegment(const std::string& argPath,
+      const std::vector<std::pair<std::string_view, ReportSlot*>>& argRows,
+      uint64_t argPeriodNanoseconds);
+    ~StatsSegment();
+
+    // Snapshot every source slot and publish into the segment; called from
+    // the report thread at its existing tick, never from an RT thread.
+    void Publish();
+
+  private:
+    std::string path;
+    std::vector<ReportSlot*> sources;
+    int descriptor = -1;
+    void* map = nullptr;
+    size_t mapLength = 0;
+    Header* header = nullptr;
+    Row* rowArray = nullptr;
+  };
+} // end namespace Evaluator
+
+#endif // !defined(RMP_EVAL_STATSSEGMENT_H)
@@ -0,0 +1,60 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#pragma once
+
+#ifndef RMP_EVAL_TUNER_H
+#define RMP_EVAL_TUNER_H
+
+#include <linux/ethtool.h>
+#include <string>
+#include <vector>
+
+#include "config.h"
+
+namespace Evaluator
+{
+  // Remediation engine for the check suite (--tune): every failed check that
+  // has a safe, reversible fix is applied before the RT threads start — CPU
+  // governor to performance, NIC IRQ affinity onto the RT core, RPS masks
+  // zeroed, timer migration off — plus NIC interrupt coalescing disabled
+  // (rx-usecs=0, adaptive-rx off) through the ethtool ioctls. Every prior
+  // value is recorded and written back at destruction, so the machine leaves
+  // the run configured exactly as it entered it.
+  class SystemTuner
+  {
+  public:
+    SystemTuner(const std::vector<CheckResult>& argResults, int argCpuCore, const std::string& argNicName);
+    ~SystemTuner();
+
+    SystemTuner(const SystemTuner&) = delete;
+    SystemTuner& operator=(const SystemTuner&) = delete;
+
+  private:
+    struct SavedValue
+    {
+      std::string Path;
+      std::string Value;
+    };
+
+    // Write value to path, recording the prior contents for rollback. Prints
+    // what changed; a failure is a WARN, never fatal — the run proceeds with
+    // whatever the host allows.
+    void TunePath(const std::string& path, const std::string& value, const std::string& what);
+
+    void TuneGovernor();
+    void TuneNicIrqAffinity();
+    void TuneRps();
+    void TuneTimerMigration();
+    void TuneCoalescing();
+    void RestoreCoalescing();
+
+    int cpuCore;
+    std::string nicName;
+    std::vector<SavedValue> savedValues;
+    bool coalesceSaved = false;
+    struct ethtool_coalesce savedCoalesce = {};
+  };
+} // end namespace Evaluator
+
+#endif // !defined(RMP_EVAL_TUNER_H)
@@ -0,0 +1,160 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <stdexcept>
+#include <unistd.h>
+
+#include "checkpointwriter.h"
+#include "nictest.h" // AppendErrorCode
+
+namespace Evaluator
+{
+  CheckpointWriter::CheckpointWriter(const std::string& argPath,
+    const std::vector<std::pair<std::string_view, ReportSlot*>>& argRows,
+    uint64_t argPeriodNanoseconds, std::chrono::seconds argInterval,
+    std::chrono::steady_clock::time_point argStartTime)
+    : path(argPath)
+    , periodNanoseconds(argPeriodNanoseconds)
+    , interval(argInterval)
+    , startTime(argStartTime)
+  {
+    for (const auto& [label, slot] : argRows)
+    {
+      rows.emplace_back(std::string(label), slot);
+    }
+
+    // Fail fast: a checkpoint that cannot be written should stop the soak at
+    // minute zero, not be discovered at hour 60.
+    if (!WriteCheckpoint())
+    {
+      throw std::runtime_error(AppendErrorCode("Failed to write checkpoint: " + path));
+    }
+
+    writer = std::thread(&CheckpointWriter::WriterThread, this);
+  }
+
+  bool CheckpointWriter::WriteCheckpoint()
+  {
+    const std::string temporary = path + ".tmp";
+    const int descriptor = open(temporary.c_str(), O_CREAT | O_WRONLY | O_TRUNC | O_CLOEXEC, 0644);
+    if (descriptor < 0)
+    {
+      return false;
+    }
+
+    Header header = {};
+    std::memcpy(header.Magic, "RMPEVCP", 8);
+    header.Version = FileVersion;
+    header.RowCount = static_cast<uint32_t>(rows.size());
+    header.PeriodNanoseconds = periodNanoseconds;
+    header.ElapsedNanoseconds = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+
+    bool ok = write(descriptor, &header, sizeof(header)) == static_cast<ssize_t>(sizeof(header));
+    for (const auto& [label, slot] : rows)
+    {
+      Row row = {};
+      const size_t length = std::min(label.size(), MaxLabelSize - 1);
+      std::memcpy(row.Label, label.data(), length);
+      row.Data = slot->Read(); // seqlock snapshot; never blocks the RT writer
+      ok = ok && write(descriptor, &row, sizeof(row)) == static_cast<ssize_t>(sizeof(row));
+    }
+
+    // fsync before the rename: the rename is atomic, but only durable data
+    // behind it makes the checkpoint worth anything after a power cut.
+    ok = ok && fsync(descriptor) == 0;
+    close(descriptor);
+    ok = ok && std::rename(temporary.c_str(), path.c_str()) == 0;
+    return ok;
+  }
+
+  void CheckpointWriter::WriterThread()
+  {
+    while (running.load(std::memory_order_acquire))
+    {
+      // Sleep in small steps so teardown does not wait out a long interval.
+      static constexpr auto SleepStep = std::chrono::milliseconds(200);
+      auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(interval);
+      while (remaining.count() > 0 && running.load(std::memory_order_acquire))
+      {
+        const auto step = std::min<std::chrono::milliseconds>(SleepStep, remaining);
+        std::this_thread::sleep_for(step);
+        remaining -= step;
+      }
+      if (!running.load(std::memory_order_acquire))
+      {
+        break;
+      }
+      if (!WriteCheckpoint() && !warned)
+      {
+        warned = true;
+        std::cerr << "WARN: " << AppendErrorCode("Failed to write checkpoint: " + path) << std::endl;
+      }
+    }
+  }
+
+  CheckpointWriter::~CheckpointWriter()
+  {
+    running.store(false, std::memory_order_release);
+    if (writer.joinable())
+    {
+      writer.join();
+    }
+    // One final checkpoint so a clean exit leaves the end-of-run totals.
+    WriteCheckpoint();
+  }
+
+  const ReportData* CheckpointState::Find(std::string_view label) const
+  {
+    for (const auto& [rowLabel, data] : Rows)
+    {
+      if (rowLabel == label)
+      {
+        return &data;
+      }
+    }
+    return nullptr;
+  }
+
+  CheckpointState LoadCheckpoint(const std::string& path)
+  {
+    const int descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0)
+    {
+      throw std::runtime_error(AppendErrorCode("Failed to open checkpoint: " + path));
+    }
+
+    CheckpointWriter::Header header = {};
+    if (read(descriptor, &header, sizeof(header)) != static_cast<ssize_t>(sizeof(header)))
+    {
+      close(descriptor);
+      throw std::runtime_error("Checkpoint " + path + " is truncated.");
+    }
+    if (std::memcmp(header.Magic, "RMPEVCP", 8) != 0 || header.Version != CheckpointWriter::FileVersion)
+    {
+      close(descriptor);
+      throw std::runtime_error("Checkpoint " + path + " has an unknown format or version.");
+    }
+
+    CheckpointState state;
+    state.PeriodNanoseconds = header.PeriodNanoseconds;
+    state.ElapsedNanoseconds = header.ElapsedNanoseconds;
+    for (uint32_t index = 0; index < header.RowCount; ++index)
+    {
+      CheckpointWriter::Row row = {};
+      if (read(descriptor, &row, sizeof(row)) != static_cast<ssize_t>(sizeof(row)))
+      {
+        close(descriptor);
+        throw std::runtime_error("Checkpoint " + path + " is truncated.");
+      }
+      row.Label[CheckpointWriter::MaxLabelSize - 1] = '\0';
+      state.Rows.emplace_back(row.Label, row.Data);
+    }
+    close(descriptor);
+    return state;
+  }
+} // end namespace Evaluator
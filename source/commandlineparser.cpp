@@ -52,8 +52,12 @@ namespace Evaluator
       {
         if (std::find(argument.Flags.begin(), argument.Flags.end(), flag) != std::end(argument.Flags))
         {
-          // Check if we've already parsed this flag
-          if (parsedSet.find(argument.Help) != parsedSet.end())
+          const bool isRepeatable = std::holds_alternative<std::vector<std::string>*>(argument.Value)
+            || std::holds_alternative<std::vector<int32_t>*>(argument.Value);
+
+          // Check if we've already parsed this flag (repeatable arguments
+          // accumulate instead)
+          if (!isRepeatable && parsedSet.find(argument.Help) != parsedSet.end())
           {
             std::cerr << "Duplicate command line argument \"" + flag + "\"!\n";
             return false;
@@ -85,13 +89,28 @@ namespace Evaluator
           else if (std::holds_alternative<std::string*>(argument.Value)) {
             *std::get<std::string*>(argument.Value) = value;
           }
+          // Repeatable arguments append each occurrence's value.
+          else if (std::holds_alternative<std::vector<std::string>*>(argument.Value)) {
+            std::get<std::vector<std::string>*>(argument.Value)->push_back(value);
+          }
+          else if (std::holds_alternative<std::vector<int32_t>*>(argument.Value)) {
+            int32_t parsed = 0;
+            std::stringstream sstr(value);
+            sstr >> parsed;
+            std::get<std::vector<int32_t>*>(argument.Value)->push_back(parsed);
+          }
           // In all other cases we use a std::stringstream to
           // convert the value.
           else {
             std::visit(
               [&value](auto&& arg) {
-                std::stringstream sstr(value);
-                sstr >> *arg;
+                // Vector alternatives are handled above; this keeps the
+                // generic extraction from being instantiated for them.
+                if constexpr (requires(std::stringstream& stream) { stream >> *arg; })
+                {
+                  std::stringstream sstr(value);
+                  sstr >> *arg;
+                }
               },
               argument.Value);
           }
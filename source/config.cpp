@@ -15,11 +15,13 @@
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <ifaddrs.h>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <net/if.h>
 #include <netinet/in.h>
 #include <optional>
@@ -30,6 +32,7 @@
 #include <sys/stat.h>
 #include <sys/utsname.h>
 #include <unistd.h>
+#include <unordered_map>
 #include <vector>
 
 namespace fs = std::filesystem;
@@ -278,6 +281,63 @@ namespace Evaluator
     [[nodiscard]] std::optional<std::string> CmdLineParam(std::string_view key) const override { return GetCmdLineParam(key); }
   };
 
+  // Decorator that caches every underlying read for the lifetime of one
+  // configuration report. Several checks consult the same files (half the
+  // isolation checks re-parse /proc/cmdline), which adds up on slow eMMC.
+  // Each unique path is read exactly once even under concurrent evaluation:
+  // the first caller installs a shared_future and performs the read outside
+  // the map lock, later callers wait on that future.
+  class CachingDataSource final : public IDataSource
+  {
+  public:
+    explicit CachingDataSource(const IDataSource &argSource) : source(argSource) {}
+
+    [[nodiscard]] std::optional<std::string> Read(const std::string &path) const override
+    {
+      return CachedLookup(fileCache, path, [&] { return source.Read(path); });
+    }
+
+    [[nodiscard]] std::optional<std::string> CmdLineParam(std::string_view key) const override
+    {
+      return CachedLookup(paramCache, std::string(key), [&] { return source.CmdLineParam(key); });
+    }
+
+  private:
+    using CacheMap = std::unordered_map<std::string, std::shared_future<std::optional<std::string>>>;
+
+    template <typename ReadFunction>
+    std::optional<std::string> CachedLookup(CacheMap &cache, const std::string &key, ReadFunction readFunction) const
+    {
+      std::promise<std::optional<std::string>> promise;
+      std::shared_future<std::optional<std::string>> future;
+      bool firstReader = false;
+      {
+        std::lock_guard lock(mutex);
+        auto found = cache.find(key);
+        if (found == cache.end())
+        {
+          future = promise.get_future().share();
+          cache.emplace(key, future);
+          firstReader = true;
+        }
+        else
+        {
+          future = found->second;
+        }
+      }
+      if (firstReader)
+      {
+        promise.set_value(readFunction());
+      }
+      return future.get();
+    }
+
+    const IDataSource &source;
+    mutable std::mutex mutex;
+    mutable CacheMap fileCache;
+    mutable CacheMap paramCache;
+  };
+
   // Check implementations
   // All check classes are kept private to this compilation unit
 
@@ -1031,6 +1091,41 @@ namespace Evaluator
     }
   };
 
+  // On multi-socket hosts the RT cores should sit on the same NUMA node as
+  // the NIC's PCIe root complex; a remote core pays an interconnect hop on
+  // every descriptor-ring and doorbell access.
+  class NicNumaLocalCheck final : public ICheck
+  {
+  public:
+    [[nodiscard]] CheckKind Kind() const noexcept override { return CheckKind::NicNumaLocal; }
+    [[nodiscard]] const std::string& Name() const noexcept override { static const std::string k = "NIC and RT core on same NUMA node"; return k; }
+    [[nodiscard]] Domain GetDomain() const noexcept override { return Domain::Nic; }
+
+    [[nodiscard]] CheckResult Evaluate(const CheckContext& checkContext, const IDataSource& dataSource) const override
+    {
+      if (!checkContext.nic) return { Kind(), Status::Unknown, Name(), "no NIC in context" };
+      if (!checkContext.cpu) return { Kind(), Status::Unknown, Name(), "no CPU subject" };
+      auto node_value = dataSource.Read(std::string("/sys/class/net/") + *checkContext.nic + "/device/numa_node");
+      if (!node_value) return { Kind(), Status::Unknown, Name(), "no numa_node attribute" };
+      int nic_node = -1;
+      try { nic_node = std::stoi(Trim(*node_value)); } catch (...) {}
+      if (nic_node < 0)
+      {
+        return { Kind(), Status::Pass, Name(), "numa_node is -1 (single-node host)" };
+      }
+      auto cpulist_value = dataSource.Read("/sys/devices/system/node/node" + std::to_string(nic_node) + "/cpulist");
+      if (!cpulist_value) return { Kind(), Status::Unknown, Name(), std::string("no cpulist for node ") + std::to_string(nic_node) };
+      std::string raw = Trim(*cpulist_value);
+      auto set = ParseCpuList(raw);
+      if (set.count(*checkContext.cpu))
+      {
+        return { Kind(), Status::Pass, Name(), std::string("node ") + std::to_string(nic_node) + " (cpus " + raw + ")" };
+      }
+      return { Kind(), Status::Fail, Name(), std::string("CPU") + std::to_string(*checkContext.cpu)
+        + " is not on NIC node " + std::to_string(nic_node) + " (cpus " + raw + ")" };
+    }
+  };
+
   // Helper functions for system info
 
   std::string GetCpuInfo()
@@ -1080,6 +1175,45 @@ namespace Evaluator
     return output.str();
   }
   
+  std::vector<int> GetIsolatedCpus()
+  {
+    // Prefer the kernel's resolved view; fall back to the boot cmdline when
+    // the sysfs file is absent (older kernels).
+    std::string raw;
+    if (auto sysfs_value = Slurp("/sys/devices/system/cpu/isolated"))
+    {
+      raw = Trim(*sysfs_value);
+    }
+    if (raw.empty())
+    {
+      if (auto cmdline_value = GetCmdLineParam("isolcpus"))
+      {
+        // isolcpus accepts flag prefixes like "domain,managed_irq,2-5"; the
+        // CPU list is whatever ParseCpuList can extract from the value.
+        raw = *cmdline_value;
+      }
+    }
+    auto set = ParseCpuList(raw);
+    return std::vector<int>(set.begin(), set.end());
+  }
+
+  int GetNicNumaNode(std::string_view nicName)
+  {
+    if (nicName.empty()) return -1;
+    auto value = Slurp(std::string("/sys/class/net/") + std::string(nicName) + "/device/numa_node");
+    if (!value) return -1;
+    try { return std::stoi(Trim(*value)); } catch (...) { return -1; }
+  }
+
+  std::vector<int> GetNodeCpus(int node)
+  {
+    if (node < 0) return {};
+    auto value = Slurp("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    if (!value) return {};
+    auto set = ParseCpuList(Trim(*value));
+    return std::vector<int>(set.begin(), set.end());
+  }
+
   std::string GetKernelInfo()
   {
     std::ostringstream output;
@@ -1094,13 +1228,15 @@ namespace Evaluator
     return output.str();
   }
 
-  void ReportSystemConfiguration(int cpu, std::string_view nicName)
+  std::vector<CheckResult> ReportSystemConfiguration(int cpu, std::string_view nicName)
   {
+    std::vector<CheckResult> results;
+
     auto cpuCount = CpuCount();
     if (cpu < 0 || cpu >= cpuCount)
     {
       std::cerr << "Invalid CPU core " << cpu << "; must be between 0 and " << (cpuCount - 1) << "\n";
-      return;
+      return results;
     }
 
     std::cout << GetCpuInfo() << "\n";
@@ -1115,7 +1251,34 @@ namespace Evaluator
     {
       checkContext.nic = std::string(nicName);
     }
-    Evaluator::SystemFileSystemDataSource data;
+    Evaluator::SystemFileSystemDataSource fileSystemData;
+    // Checks run concurrently below, so shared files are read once instead of
+    // once per check; on slow eMMC this dominates startup time.
+    Evaluator::CachingDataSource data(fileSystemData);
+
+    // Checks within a group are independent, so evaluate them concurrently
+    // and collect the futures in declaration order, which keeps the printed
+    // report identical to the serial version.
+    auto launchChecks = [&](const std::vector<std::unique_ptr<Evaluator::ICheck>> &checks)
+    {
+      std::vector<std::future<Evaluator::CheckResult>> futures;
+      futures.reserve(checks.size());
+      for (const auto &check : checks)
+      {
+        futures.push_back(std::async(std::launch::async,
+          [&checkContext, &data, &check] { return check->Evaluate(checkContext, data); }));
+      }
+      return futures;
+    };
+    auto printChecks = [&](std::vector<std::future<Evaluator::CheckResult>> &futures)
+    {
+      for (auto &future : futures)
+      {
+        auto result = future.get();
+        PrintResult(result);
+        results.push_back(std::move(result));
+      }
+    };
 
     // System-wide checks
     std::vector<std::unique_ptr<Evaluator::ICheck>> system_checks;
@@ -1125,14 +1288,7 @@ namespace Evaluator
     system_checks.emplace_back(std::make_unique<Evaluator::RtThrottlingCheck>());
     system_checks.emplace_back(std::make_unique<Evaluator::ClocksourceCheck>());
 
-    for (const auto &check : system_checks)
-    {
-      auto result = check->Evaluate(checkContext, data);
-      PrintResult(result);
-    }
-
     // CPU Core checks
-    PrintSectionHeader("Core " + std::to_string(cpu) + " Checks");
     std::vector<std::unique_ptr<Evaluator::ICheck>> core_checks;
     core_checks.emplace_back(std::make_unique<Evaluator::CoreIsolatedCheck>());
     core_checks.emplace_back(std::make_unique<Evaluator::NohzFullCheck>());
@@ -1145,11 +1301,12 @@ namespace Evaluator
     core_checks.emplace_back(std::make_unique<Evaluator::CStatesCappedCheck>());
     core_checks.emplace_back(std::make_unique<Evaluator::TurboPolicyCheck>());
 
-    for (const auto &check : core_checks)
-    {
-      auto result = check->Evaluate(checkContext, data);
-      PrintResult(result);
-    }
+    auto systemFutures = launchChecks(system_checks);
+    auto coreFutures = launchChecks(core_checks);
+    printChecks(systemFutures);
+
+    PrintSectionHeader("Core " + std::to_string(cpu) + " Checks");
+    printChecks(coreFutures);
 
     if (checkContext.nic)
     {
@@ -1159,6 +1316,7 @@ namespace Evaluator
       auto presence = presence_check.Evaluate(checkContext, data);
       PrintResult(presence);
       const bool nic_ok = (presence.status == Evaluator::Status::Pass);
+      results.push_back(std::move(presence));
 
       if (nic_ok)
       {
@@ -1167,16 +1325,16 @@ namespace Evaluator
         nic_checks.emplace_back(std::make_unique<Evaluator::NicQuietCheck>());
         nic_checks.emplace_back(std::make_unique<Evaluator::NicIrqsPinnedCheck>());
         nic_checks.emplace_back(std::make_unique<Evaluator::RpsDisabledCheck>());
-        for (const auto &check : nic_checks)
-        {
-          auto result = check->Evaluate(checkContext, data);
-          PrintResult(result);
-        }
+        nic_checks.emplace_back(std::make_unique<Evaluator::NicNumaLocalCheck>());
+        auto nicFutures = launchChecks(nic_checks);
+        printChecks(nicFutures);
       }
     }
 
     // Add an extra newline to separate from any following console output
     std::cout << "\n";
+
+    return results;
   }
 } // end namespace Evaluator
 
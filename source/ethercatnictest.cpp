@@ -1,6 +1,7 @@
 // Copyright (c) 2025 Robotic Systems Integration, Inc.
 // Licensed under the MIT License. See LICENSE file in the project root for details.
 
+#include <algorithm>
 #include <arpa/inet.h>
 #include <cstdio>
 #include <cstring>
@@ -24,6 +25,61 @@ namespace Evaluator
 {
   void DoNothing() {}
 
+  namespace
+  {
+    // Constant parts of the probe frame, computed at compile time. Only the
+    // EtherCAT header length and the more-datagrams flags depend on the
+    // requested sub-datagram count.
+    constexpr auto FrameHeaderTemplate = []
+    {
+      std::array<unsigned char, EthernetHeaderSize> header = {};
+      for (size_t byte = 0; byte < 6; ++byte)
+      {
+        header[byte] = 0xff; // broadcast destination; source stays all zero
+      }
+      header[12] = 0x88; header[13] = 0xa4; // EtherCAT frame type
+      return header;
+    }();
+
+    constexpr auto DatagramTemplate = []
+    {
+      std::array<unsigned char, DatagramSize> datagram = {};
+      datagram[0] = 0x08; // BRD command
+      datagram[1] = 0xff; // index
+      // auto-increment address [2..3] stays zero
+      datagram[4] = 0x00; datagram[5] = 0x05; // offset address
+      datagram[6] = DatagramDataSize; // data length; bit 15 = more datagrams follow
+      return datagram;
+    }();
+  } // end anonymous namespace
+
+  size_t BuildProbeFrame(unsigned char* buffer, int datagramCount)
+  {
+    if (datagramCount < 1 || datagramCount > MaxDatagrams)
+    {
+      throw std::runtime_error("Datagram count must be between 1 and " + std::to_string(MaxDatagrams)
+        + ", got " + std::to_string(datagramCount));
+    }
+
+    std::memcpy(buffer, FrameHeaderTemplate.data(), FrameHeaderTemplate.size());
+
+    const uint16_t ethercatLength = static_cast<uint16_t>(datagramCount * DatagramSize);
+    buffer[14] = static_cast<unsigned char>(ethercatLength & 0xff);
+    buffer[15] = static_cast<unsigned char>(((ethercatLength >> 8) & 0x07) | 0x10); // type 1: command
+
+    size_t offset = EthernetHeaderSize + EthercatHeaderSize;
+    for (int datagram = 0; datagram < datagramCount; ++datagram)
+    {
+      std::memcpy(buffer + offset, DatagramTemplate.data(), DatagramTemplate.size());
+      if (datagram + 1 < datagramCount)
+      {
+        buffer[offset + 7] |= 0x80; // more datagrams follow
+      }
+      offset += DatagramSize;
+    }
+    return offset;
+  }
+
   std::string AppendErrorCode(const std::string_view message)
   {
     static constexpr size_t bufferSize = 256;
@@ -36,7 +92,38 @@ namespace Evaluator
     : params(argParams)
     , hardwareReport(std::move(hardwareReport))
     , softwareReport(std::move(softwareReport))
+    , wireReport(0, argParams.BucketWidth, argParams.WireData)
   {
+    frameLength = BuildProbeFrame(frameBuffer.data(), params.Datagrams);
+
+    if (params.Burst < 1 || params.Burst > MaxBurst)
+    {
+      throw std::runtime_error("Burst count must be between 1 and " + std::to_string(MaxBurst)
+        + ", got " + std::to_string(params.Burst));
+    }
+    if (params.Burst > 1)
+    {
+      // Every message of the burst carries the same prebuilt probe frame;
+      // only the receive control buffers change per cycle.
+      sendVectors.resize(params.Burst);
+      sendMessages.resize(params.Burst);
+      receiveVectors.resize(params.Burst);
+      receiveMessages.resize(params.Burst);
+      receiveBuffers.resize(params.Burst);
+      receiveControls.resize(params.Burst);
+      for (int message = 0; message < params.Burst; ++message)
+      {
+        sendVectors[message] = { frameBuffer.data(), frameLength };
+        sendMessages[message] = {};
+        sendMessages[message].msg_hdr.msg_iov = &sendVectors[message];
+        sendMessages[message].msg_hdr.msg_iovlen = 1;
+        receiveVectors[message] = { receiveBuffers[message].data(), receiveBuffers[message].size() };
+        receiveMessages[message] = {};
+        receiveMessages[message].msg_hdr.msg_iov = &receiveVectors[message];
+        receiveMessages[message].msg_hdr.msg_iovlen = 1;
+      }
+    }
+
     // Create the socket
     socketDescriptor = socket(PF_PACKET, SOCK_RAW, htons(EthernetFrameTypeBKHF));
     if (socketDescriptor == -1)
@@ -56,17 +143,32 @@ namespace Evaluator
     if (setsockopt(socketDescriptor, SOL_SOCKET, SO_DONTROUTE, &dontRoute, sizeof(dontRoute)) == -1)
     { throw std::runtime_error(AppendErrorCode("Failed to set socket routing to 'dont route'.")); }
 
-    // constexpr int pollMicroseconds = 50;
-    // if (setsockopt(socketDescriptor, SOL_SOCKET, SO_BUSY_POLL, &pollMicroseconds, sizeof(pollMicroseconds)) == -1)
-    // {
-    //   throw std::runtime_error("Failed to set SO_BUSY_POLL option on socket interface.");
-    // }
+    if (params.BusyPoll)
+    {
+      // Let the kernel busy-poll the NIC driver on our behalf when we do
+      // enter recvmsg, and make the socket nonblocking so the userspace spin
+      // in Receive() never sleeps.
+      constexpr int pollMicroseconds = 50;
+      if (setsockopt(socketDescriptor, SOL_SOCKET, SO_BUSY_POLL, &pollMicroseconds, sizeof(pollMicroseconds)) == -1)
+      {
+        throw std::runtime_error(AppendErrorCode("Failed to set SO_BUSY_POLL option on socket interface."));
+      }
 
-    // constexpr int pollPacketBudget = 32;
-    // if (setsockopt(socketDescriptor, SOL_SOCKET, SO_BUSY_POLL_BUDGET, &pollPacketBudget, sizeof(pollPacketBudget)) == -1)
-    // {
-    //   throw std::runtime_error("Failed to set SO_BUSY_POLL_BUDGET option on socket interface.");
-    // }
+#if defined(SO_BUSY_POLL_BUDGET)
+      constexpr int pollPacketBudget = 32;
+      if (setsockopt(socketDescriptor, SOL_SOCKET, SO_BUSY_POLL_BUDGET, &pollPacketBudget, sizeof(pollPacketBudget)) == -1)
+      {
+        // Pre-5.11 kernels lack the knob; the spin still works without it.
+        std::cout << "WARN: failed to set SO_BUSY_POLL_BUDGET: " << std::strerror(errno) << "\n";
+      }
+#endif // defined(SO_BUSY_POLL_BUDGET)
+
+      const int descriptorFlags = fcntl(socketDescriptor, F_GETFL, 0);
+      if (descriptorFlags == -1 || fcntl(socketDescriptor, F_SETFL, descriptorFlags | O_NONBLOCK) == -1)
+      {
+        throw std::runtime_error(AppendErrorCode("Failed to set socket nonblocking for busy-poll mode."));
+      }
+    }
 
     // enable timestamping
     struct ifreq ifrts = {};
@@ -77,8 +179,11 @@ namespace Evaluator
     ifrts.ifr_data = (char *)&cfg;
     ioctl(socketDescriptor, SIOCSHWTSTAMP, &ifrts); // check cfg echoed back
 
+    // OPT_TSONLY keeps the error-queue completions to a timestamp each
+    // instead of a full frame copy.
     int tflags = SOF_TIMESTAMPING_TX_HARDWARE | SOF_TIMESTAMPING_RX_HARDWARE |
-              SOF_TIMESTAMPING_RAW_HARDWARE | SOF_TIMESTAMPING_SOFTWARE;
+              SOF_TIMESTAMPING_RAW_HARDWARE | SOF_TIMESTAMPING_SOFTWARE |
+              SOF_TIMESTAMPING_OPT_TSONLY;
     if (setsockopt(socketDescriptor, SOL_SOCKET, SO_TIMESTAMPING_NEW, &tflags, sizeof(tflags)) == -1)
     {
       throw std::runtime_error(AppendErrorCode("Failed to set SO_TIMESTAMPING_NEW option on socket interface."));
@@ -120,54 +225,31 @@ namespace Evaluator
 
   void EthercatNicTest::Send()
   {
-    static constexpr size_t packetSize = 29;
-    unsigned char pData[packetSize] = {0};
-
-    // Set the broadcast address as the destination in the frame data.
-    unsigned char* macDestination = &pData[0];
-    memset(macDestination, 0xff, 6);
-
-    // Set the mac address source to all zeroes
-    unsigned char* macSource = &pData[6];
-    memset(macSource, 0x00, 6);
-
-    // Set the frame type to EtherCAT
-    pData[12] = 0x88; pData[13] = 0xa4;
-
-    // Set the Ethercat frame length
-    pData[14] = 0x0d;
-    // Set the EtherCAT frame type (command)
-    pData[15] = 0x10;
-    // Set the EtherCAT command
-    pData[16] = 0x08;
-    // Set the index
-    pData[17] = 0xff;
-    // Set the subordinate address
-    memset(&pData[18], 0x00, 2);
-    // Set the offset address
-    pData[20] = 0x00; pData[21] = 0x05;
-    // Set No roundtrip - Last Sub Command, also length?
-    pData[22] = 0x01;
-
-    {
-      std::unique_lock lock(mutex);
-      if (!condition.wait_for(lock, SocketTimeout,
-        [this]
-        {
-          return receiveIteration > sendIteration;
-        }))
+    // Bounded spin until the receiver has parked on the socket.
+    {
+      const uint64_t currentSend = sendIteration.load(std::memory_order_relaxed);
+      if (!SpinWaitAbove(receiveIteration, currentSend, SocketTimeout))
       {
         char buffer[128] = {};
         std::snprintf(buffer, sizeof(buffer), "Timed out waiting for receiver to be ready. sendIteration=%lu, receiveIteration=%lu",
-          sendIteration, receiveIteration);
+          currentSend, receiveIteration.load(std::memory_order_relaxed));
         throw std::runtime_error(buffer);
       }
     }
 
-    if (send(socketDescriptor, pData, packetSize, 0) == -1)
+    // The frame was assembled once at construction; nothing to rebuild here.
+    if (params.Burst > 1)
+    {
+      // One syscall for the whole burst; a short count means the qdisc or
+      // driver ring rejected part of it, which is itself a headroom failure.
+      const int sent = sendmmsg(socketDescriptor, sendMessages.data(), params.Burst, 0);
+      if (sent != params.Burst)
+      { throw std::runtime_error(AppendErrorCode("Failed to send the full burst on socket.")); }
+    }
+    else if (send(socketDescriptor, frameBuffer.data(), frameLength, 0) == -1)
     { throw std::runtime_error(AppendErrorCode("Failed to send data on socket.")); }
 
-    ++sendIteration;
+    sendIteration.fetch_add(1, std::memory_order_release);
   }
 
   // Convert (timespec-like) to ns
@@ -185,33 +267,15 @@ namespace Evaluator
 
   bool EthercatNicTest::Receive()
   {
-    // Set up polling
-    constexpr int numFds = 1; // number of file descriptors
-    static pollfd pollFd = { .fd=socketDescriptor, .events=POLLIN, .revents=0 };
-    pollfd pollFds[numFds] = {};	// array of pollfd structs.
-    pollFds[0] = pollFd;
-    constexpr int timeoutMs = 1000;
-
-    {
-      std::unique_lock lock(mutex);
-      ++receiveIteration;
-    }
-    condition.notify_all();
-
-    int ready = poll(pollFds, numFds, timeoutMs);
-    if (ready < 0)
+    if (params.Burst > 1)
     {
-      throw std::runtime_error(AppendErrorCode("There was an error during frame polling on socket."));
-    }
-    else if (ready == 0)
-    {
-      return false;
+      return ReceiveBurst();
     }
 
-    /**** Some code to use base recv() ****/
-    // int bytesReceived = recv(socketDescriptor, recvBuffer, bufferSize, 0);
-    // if (bytesReceived < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
-    // { throw std::runtime_error("recv() had an error when reading bytes from socket."); }
+    // Signal the sender that we are about to park on the socket. The release
+    // store pairs with the sender's acquire load; the sender spins rather than
+    // sleeping, so no wakeup syscall is needed.
+    receiveIteration.fetch_add(1, std::memory_order_release);
 
     /**** Some code to use recvmsg() to obtain timestamps from the socket ****/
     // Payload + control buffers
@@ -228,10 +292,56 @@ namespace Evaluator
     msg.msg_control    = control;
     msg.msg_controllen = sizeof(control);
 
-    ssize_t n = recvmsg(socketDescriptor, &msg, 0);
-    if (n < 0) {
-      perror("recvmsg");
-      return false;
+    ssize_t n = 0;
+    if (params.BusyPoll)
+    {
+      // Bounded spin on the nonblocking socket: no poll() wakeup, no
+      // scheduler involvement on the isolated receive core. The deadline
+      // clock is only consulted every few hundred spins.
+      static constexpr int SpinsPerDeadlineCheck = 512;
+      const uint64_t deadline = GetCurrentTime() +
+        std::chrono::duration_cast<std::chrono::nanoseconds>(SocketTimeout).count();
+      int spins = 0;
+      while ((n = recvmsg(socketDescriptor, &msg, MSG_DONTWAIT)) < 0)
+      {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+          perror("recvmsg");
+          return false;
+        }
+        CpuRelax();
+        if (++spins >= SpinsPerDeadlineCheck)
+        {
+          spins = 0;
+          if (GetCurrentTime() >= deadline)
+          {
+            return false;
+          }
+        }
+      }
+    }
+    else
+    {
+      // Set up polling
+      constexpr int numFds = 1; // number of file descriptors
+      pollfd pollFds[numFds] = { { .fd=socketDescriptor, .events=POLLIN, .revents=0 } };
+      constexpr int timeoutMs = 1000;
+
+      int ready = poll(pollFds, numFds, timeoutMs);
+      if (ready < 0)
+      {
+        throw std::runtime_error(AppendErrorCode("There was an error during frame polling on socket."));
+      }
+      else if (ready == 0)
+      {
+        return false;
+      }
+
+      n = recvmsg(socketDescriptor, &msg, 0);
+      if (n < 0) {
+        perror("recvmsg");
+        return false;
+      }
     }
 
     bool haveHardware = false, haveSoftware = false;
@@ -264,8 +374,9 @@ namespace Evaluator
         // Inter-arrival should be non-negative; if negative, skip (clock step/rollover)
         if (delta >= 0)
         {
-          hardwareReport.AddObservation(static_cast<uint64_t>(delta), static_cast<int>(receiveIteration));
-          stats.HardwareDeltaNanoseconds.update(delta, receiveIteration);
+          const uint64_t iteration = receiveIteration.load(std::memory_order_relaxed);
+          hardwareReport.AddObservation(static_cast<uint64_t>(delta), static_cast<int>(iteration));
+          stats.HardwareDeltaNanoseconds.update(delta, iteration);
         }
       }
       prev.HardwareNanoseconds = hardwareNanoseconds;
@@ -280,14 +391,195 @@ namespace Evaluator
         int64_t delta = softwareNanoseconds - prev.SoftwareNanoseconds;
         if (delta >= 0)
         {
-          softwareReport.AddObservation(static_cast<uint64_t>(delta), static_cast<int>(receiveIteration));
-          stats.SoftwareDeltaNanoseconds.update(delta, receiveIteration);
+          const uint64_t iteration = receiveIteration.load(std::memory_order_relaxed);
+          softwareReport.AddObservation(static_cast<uint64_t>(delta), static_cast<int>(iteration));
+          stats.SoftwareDeltaNanoseconds.update(delta, iteration);
         }
       }
       prev.SoftwareNanoseconds = softwareNanoseconds;
       prev.HaveSoftware = true;
     }
 
+    // One-way wire+device latency: pair the TX hardware timestamps that have
+    // completed on the error queue with this cycle's RX hardware timestamp.
+    if (haveHardware && params.WireData != nullptr)
+    {
+      DrainTxTimestamps(hardwareNanoseconds);
+    }
+
+    return true;
+  }
+
+  void EthercatNicTest::DrainTxTimestamps(int64_t rxHardwareNanoseconds)
+  {
+    char control[512];
+    for (;;)
+    {
+      struct msghdr msg = {};
+      msg.msg_control = control;
+      msg.msg_controllen = sizeof(control);
+      if (recvmsg(socketDescriptor, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+      {
+        return; // EAGAIN: no completions pending
+      }
+
+      for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+      {
+        if (cmsg->cmsg_level == SOL_SOCKET &&
+            (cmsg->cmsg_type == SO_TIMESTAMPING_NEW || cmsg->cmsg_type == SCM_TIMESTAMPING))
+        {
+          struct timespec* ts = reinterpret_cast<struct timespec*>(CMSG_DATA(cmsg));
+          if (ts[2].tv_sec == 0 && ts[2].tv_nsec == 0)
+          {
+            continue; // no hardware TX timestamp in this completion
+          }
+          const int64_t delta = rxHardwareNanoseconds - to_ns(ts[2]);
+          // With one frame in flight the TX timestamp belongs to the frame
+          // just received. A completion surfacing a cycle late would pair
+          // with the wrong RX timestamp and inflate the sample by a full
+          // period, so anything at or beyond the period is dropped.
+          if (delta >= 0 && delta < static_cast<int64_t>(params.SendSleep))
+          {
+            const uint64_t iteration = receiveIteration.load(std::memory_order_relaxed);
+            wireReport.AddObservation(static_cast<uint64_t>(delta), static_cast<int>(iteration));
+          }
+        }
+      }
+    }
+  }
+
+  bool EthercatNicTest::ReceiveBurst()
+  {
+    // Same rendezvous as the single-frame path: park announcement first, so
+    // the sender's bounded spin sees us before it fires the burst.
+    receiveIteration.fetch_add(1, std::memory_order_release);
+
+    const int burst = params.Burst;
+    for (int message = 0; message < burst; ++message)
+    {
+      // recvmmsg overwrites these per call, so re-arm them every cycle.
+      receiveMessages[message].msg_hdr.msg_control = receiveControls[message].data();
+      receiveMessages[message].msg_hdr.msg_controllen = receiveControls[message].size();
+      receiveMessages[message].msg_len = 0;
+    }
+
+    int received = 0;
+    const uint64_t deadline = GetCurrentTime() +
+      std::chrono::duration_cast<std::chrono::nanoseconds>(SocketTimeout).count();
+    while (received < burst)
+    {
+      if (!params.BusyPoll)
+      {
+        constexpr int timeoutMs = 1000;
+        pollfd pollFd = { .fd = socketDescriptor, .events = POLLIN, .revents = 0 };
+        const int ready = poll(&pollFd, 1, timeoutMs);
+        if (ready < 0)
+        {
+          throw std::runtime_error(AppendErrorCode("There was an error during frame polling on socket."));
+        }
+        if (ready == 0)
+        {
+          return false;
+        }
+      }
+      const int count = recvmmsg(socketDescriptor, receiveMessages.data() + received,
+        static_cast<unsigned int>(burst - received), MSG_DONTWAIT, nullptr);
+      if (count < 0)
+      {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+          CpuRelax();
+          if (GetCurrentTime() >= deadline)
+          {
+            return false; // partial burst: the stack fell off the cliff we are probing for
+          }
+          continue;
+        }
+        perror("recvmmsg");
+        return false;
+      }
+      received += count;
+    }
+
+    // Walk every message's timestamps. The first frame's stamps feed the
+    // existing cycle-cadence reports (so burst size does not skew them); the
+    // spread of hardware stamps across the burst measures how the NIC smears
+    // a back-to-back batch.
+    bool haveHardware = false, haveSoftware = false;
+    int64_t firstHardware = 0, firstSoftware = 0;
+    int64_t minHardware = std::numeric_limits<int64_t>::max();
+    int64_t maxHardware = std::numeric_limits<int64_t>::min();
+    size_t hardwareCount = 0;
+    for (int message = 0; message < burst; ++message)
+    {
+      for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&receiveMessages[message].msg_hdr);
+          cmsg;
+          cmsg = CMSG_NXTHDR(&receiveMessages[message].msg_hdr, cmsg))
+      {
+        if (cmsg->cmsg_level == SOL_SOCKET &&
+            (cmsg->cmsg_type == SO_TIMESTAMPING_NEW || cmsg->cmsg_type == SCM_TIMESTAMPING))
+        {
+          struct timespec* ts = reinterpret_cast<struct timespec*>(CMSG_DATA(cmsg));
+          if (ts[0].tv_sec || ts[0].tv_nsec)
+          {
+            if (!haveSoftware) firstSoftware = to_ns(ts[0]);
+            haveSoftware = true;
+          }
+          if (ts[2].tv_sec || ts[2].tv_nsec)
+          {
+            const int64_t nanoseconds = to_ns(ts[2]);
+            if (!haveHardware) firstHardware = nanoseconds;
+            haveHardware = true;
+            ++hardwareCount;
+            minHardware = std::min(minHardware, nanoseconds);
+            maxHardware = std::max(maxHardware, nanoseconds);
+          }
+        }
+      }
+    }
+
+    const uint64_t iteration = receiveIteration.load(std::memory_order_relaxed);
+
+    if (haveHardware)
+    {
+      if (prev.HaveHardware)
+      {
+        int64_t delta = firstHardware - prev.HardwareNanoseconds;
+        if (delta >= 0)
+        {
+          hardwareReport.AddObservation(static_cast<uint64_t>(delta), static_cast<int>(iteration));
+          stats.HardwareDeltaNanoseconds.update(delta, iteration);
+        }
+      }
+      prev.HardwareNanoseconds = firstHardware;
+      prev.HaveHardware = true;
+    }
+
+    if (haveSoftware)
+    {
+      if (prev.HaveSoftware)
+      {
+        int64_t delta = firstSoftware - prev.SoftwareNanoseconds;
+        if (delta >= 0)
+        {
+          softwareReport.AddObservation(static_cast<uint64_t>(delta), static_cast<int>(iteration));
+          stats.SoftwareDeltaNanoseconds.update(delta, iteration);
+        }
+      }
+      prev.SoftwareNanoseconds = firstSoftware;
+      prev.HaveSoftware = true;
+    }
+
+    if (hardwareCount >= 2)
+    {
+      stats.BurstHardwareSpreadNanoseconds.update(maxHardware - minHardware, iteration);
+    }
+
+    if (haveHardware && params.WireData != nullptr)
+    {
+      DrainTxTimestamps(firstHardware);
+    }
+
     return true;
   }
 
@@ -310,8 +602,37 @@ namespace Evaluator
     // print_one("HW inter-arrival Delta", stats.HardwareDeltaNanoseconds);
     // print_one("SW inter-arrival Delta", stats.SoftwareDeltaNanoseconds);
 
+    if (params.Burst > 1 && stats.BurstHardwareSpreadNanoseconds.count > 0)
+    {
+      const RunningStats& spread = stats.BurstHardwareSpreadNanoseconds;
+      std::printf("Burst HW timestamp spread over %d frames (us): count=%zu min=%.3f (iter %zu) mean=%.3f max=%.3f (iter %zu)\n",
+        params.Burst, spread.count, spread.MinValue / 1000.0, spread.MinIndex,
+        spread.Mean / 1000.0, spread.MaxValue / 1000.0, spread.MaxIndex);
+    }
 
     close(socketDescriptor);
     socketDescriptor = -1;
   }
+
+  std::shared_ptr<INicTest> CreateNicTest(const TestParameters& params,
+    TimerReport&& hardwareReport, TimerReport&& softwareReport)
+  {
+    if (params.Burst > 1 && params.Backend != "raw")
+    {
+      throw std::runtime_error("--burst requires the raw backend; the ring and xdp paths move one frame per slot.");
+    }
+    if (params.Backend == "raw")
+    {
+      return std::make_shared<EthercatNicTest>(params, std::move(hardwareReport), std::move(softwareReport));
+    }
+    if (params.Backend == "ring")
+    {
+      return std::make_shared<PacketRingNicTest>(params, std::move(hardwareReport), std::move(softwareReport));
+    }
+    if (params.Backend == "xdp")
+    {
+      return std::make_shared<XdpNicTest>(params);
+    }
+    throw std::runtime_error("Unknown --backend '" + params.Backend + "'; expected 'raw', 'ring', or 'xdp'.");
+  }
 } // end namespace Evaluator
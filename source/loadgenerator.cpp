@@ -0,0 +1,235 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <algorithm>
+#include <fcntl.h>
+#include <iostream>
+#include <pthread.h>
+#include <sched.h>
+#include <stdexcept>
+#include <unistd.h>
+#include <vector>
+
+#include "loadgenerator.h"
+#include "nictest.h" // AppendErrorCode
+
+namespace
+{
+  // Bump when any worker kernel or constant below changes: the version rides
+  // in the description string, so results produced by different kernels are
+  // never silently compared.
+  constexpr int LoadVersion = 1;
+
+  // Large enough to defeat any current LLC, so every streaming pass hits
+  // memory and steals real bandwidth from the RT cores' prefetchers.
+  constexpr size_t MemBufferBytes = 64 * 1024 * 1024;
+
+  // Each io worker rewrites and fsyncs this much per pass.
+  constexpr size_t IoChunkBytes = 1 * 1024 * 1024;
+  constexpr size_t IoChunksPerPass = 8;
+
+  // Pin the calling worker to one core, leaving it at SCHED_OTHER: the load
+  // must compete like an ordinary process, never preempt the RT threads.
+  void PinWorker(int cpuCore)
+  {
+    cpu_set_t affinityMask;
+    CPU_ZERO(&affinityMask);
+    CPU_SET(cpuCore, &affinityMask);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &affinityMask) != 0)
+    {
+      std::cerr << "WARN: --load worker could not pin to CPU " << cpuCore << std::endl;
+    }
+  }
+} // end anonymous namespace
+
+namespace Evaluator
+{
+  LoadSpec LoadSpec::Parse(const std::string& text)
+  {
+    LoadSpec spec;
+    size_t position = 0;
+    while (position < text.size())
+    {
+      const size_t comma = text.find(',', position);
+      const std::string token = text.substr(position,
+        comma == std::string::npos ? std::string::npos : comma - position);
+      position = comma == std::string::npos ? text.size() : comma + 1;
+
+      const size_t colon = token.find(':');
+      int count = -1;
+      if (colon != std::string::npos)
+      {
+        try
+        {
+          size_t parsed = 0;
+          count = std::stoi(token.substr(colon + 1), &parsed);
+          if (parsed != token.size() - colon - 1)
+          {
+            count = -1;
+          }
+        }
+        catch (...)
+        {
+          count = -1;
+        }
+      }
+      const std::string kind = token.substr(0, colon);
+      if (count < 0)
+      {
+        throw std::runtime_error("Malformed --load token '" + token + "'; use cpu:N,mem:M,io:K.");
+      }
+      if (kind == "cpu") spec.CpuWorkers = count;
+      else if (kind == "mem") spec.MemWorkers = count;
+      else if (kind == "io") spec.IoWorkers = count;
+      else
+      {
+        throw std::runtime_error("Unknown --load kind '" + kind + "'; use cpu, mem or io.");
+      }
+    }
+    if (spec.CpuWorkers + spec.MemWorkers + spec.IoWorkers == 0)
+    {
+      throw std::runtime_error("--load specifies no workers; use cpu:N,mem:M,io:K.");
+    }
+    return spec;
+  }
+
+  std::string LoadSpec::Describe() const
+  {
+    return "cpu:" + std::to_string(CpuWorkers) + ",mem:" + std::to_string(MemWorkers)
+      + ",io:" + std::to_string(IoWorkers) + " (load v" + std::to_string(LoadVersion) + ")";
+  }
+
+  LoadGenerator::LoadGenerator(const LoadSpec& argSpec, const std::vector<int>& argReservedCores)
+    : description(argSpec.Describe())
+  {
+    // Every online core not reserved for an RT thread is fair game; workers
+    // are spread round-robin so cpu/mem/io pressure lands on distinct cores
+    // when there are enough of them.
+    std::vector<int> loadCores;
+    const int coreCount = static_cast<int>(std::thread::hardware_concurrency());
+    for (int core = 0; core < coreCount; ++core)
+    {
+      if (std::find(argReservedCores.begin(), argReservedCores.end(), core) == argReservedCores.end())
+      {
+        loadCores.push_back(core);
+      }
+    }
+    if (loadCores.empty())
+    {
+      throw std::runtime_error("--load found no CPU to run on; every online core is reserved for an RT thread.");
+    }
+
+    size_t nextCore = 0;
+    auto takeCore = [&]()
+    {
+      const int core = loadCores[nextCore % loadCores.size()];
+      ++nextCore;
+      return core;
+    };
+    for (int worker = 0; worker < argSpec.CpuWorkers; ++worker)
+    {
+      workers.emplace_back(&LoadGenerator::CpuWorker, this, takeCore());
+    }
+    for (int worker = 0; worker < argSpec.MemWorkers; ++worker)
+    {
+      workers.emplace_back(&LoadGenerator::MemWorker, this, takeCore());
+    }
+    for (int worker = 0; worker < argSpec.IoWorkers; ++worker)
+    {
+      workers.emplace_back(&LoadGenerator::IoWorker, this, takeCore(), worker);
+    }
+  }
+
+  LoadGenerator::~LoadGenerator()
+  {
+    running.store(false, std::memory_order_release);
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+  }
+
+  void LoadGenerator::CpuWorker(int cpuCore)
+  {
+    PinWorker(cpuCore);
+    // xorshift64 in a register: pure integer pressure with no memory
+    // footprint, and cheap enough that the stop flag is polled often.
+    uint64_t state = 0x9E3779B97F4A7C15ull + static_cast<uint64_t>(cpuCore);
+    volatile uint64_t sink = 0;
+    while (running.load(std::memory_order_acquire))
+    {
+      for (int spin = 0; spin < 4096; ++spin)
+      {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+      }
+      sink = sink + state;
+    }
+  }
+
+  void LoadGenerator::MemWorker(int cpuCore)
+  {
+    PinWorker(cpuCore);
+    // Alternating write and read-sum passes over a buffer far larger than
+    // LLC: steady cache-fill and memory-bandwidth pressure. The buffer is
+    // touched immediately, so the mlockall in main covers it up front rather
+    // than faulting it in across the first pass.
+    std::vector<uint64_t> buffer(MemBufferBytes / sizeof(uint64_t), 1);
+    volatile uint64_t sink = 0;
+    uint64_t pass = 0;
+    while (running.load(std::memory_order_acquire))
+    {
+      ++pass;
+      for (size_t index = 0; index < buffer.size(); ++index)
+      {
+        buffer[index] = pass + index;
+      }
+      if (!running.load(std::memory_order_acquire))
+      {
+        break;
+      }
+      uint64_t sum = 0;
+      for (size_t index = 0; index < buffer.size(); ++index)
+      {
+        sum += buffer[index];
+      }
+      sink = sink + sum;
+    }
+  }
+
+  void LoadGenerator::IoWorker(int cpuCore, int workerIndex)
+  {
+    PinWorker(cpuCore);
+    // Rewrite and fsync an unlinked temp file: writeback, journal and block
+    // layer pressure without leaving anything on disk afterwards.
+    const std::string path = "rmp-eval-load-" + std::to_string(workerIndex) + ".tmp";
+    const int descriptor = open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+    if (descriptor < 0)
+    {
+      std::cerr << "WARN: " << AppendErrorCode("--load io worker cannot open " + path + ".") << std::endl;
+      return;
+    }
+    unlink(path.c_str());
+
+    std::vector<char> chunk(IoChunkBytes, static_cast<char>(workerIndex));
+    while (running.load(std::memory_order_acquire))
+    {
+      if (lseek(descriptor, 0, SEEK_SET) < 0)
+      {
+        break;
+      }
+      bool wrote = true;
+      for (size_t index = 0; index < IoChunksPerPass && wrote; ++index)
+      {
+        wrote = write(descriptor, chunk.data(), chunk.size()) == static_cast<ssize_t>(chunk.size());
+      }
+      if (!wrote || fsync(descriptor) != 0)
+      {
+        std::cerr << "WARN: " << AppendErrorCode("--load io worker cannot write its temp file.") << std::endl;
+        break;
+      }
+    }
+    close(descriptor);
+  }
+} // end namespace Evaluator
@@ -21,9 +21,11 @@
 #include <poll.h>
 #include <pthread.h>
 #include <sched.h>
+#include <csignal>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <thread>
 #include <unistd.h>
 #include <unordered_set>
@@ -33,8 +35,13 @@
 #include "quantileestimator.h"
 #include "reporter.h"
 #include "nictest.h"
+#include "checkpointwriter.h"
 #include "commandlineparser.h"
 #include "config.h"
+#include "loadgenerator.h"
+#include "resultswriter.h"
+#include "statssegment.h"
+#include "tuner.h"
 #include "version.h"
 
 static std::mutex reportMutex;
@@ -62,14 +69,63 @@ std::string GetEstimatedRunTime(const uint64_t iterations, const uint64_t sleepN
 }
 
 
-void ConfigureThisThread(int priority, int cpuCore)
+// SIGXCPU deliveries under SCHED_FLAG_DL_OVERRUN, i.e. cycles where the
+// thread was still running at its deadline. Written from the signal handler,
+// read by TimerReport snapshots.
+static std::atomic<uint64_t> deadlineOverruns{0};
+
+extern "C" void OnDeadlineOverrun(int)
 {
-  sched_param sched_params;
-  sched_params.sched_priority = priority;
+  deadlineOverruns.fetch_add(1, std::memory_order_relaxed);
+}
 
+// glibc exposes neither sched_setattr nor its attribute struct, so both are
+// declared here per sched_setattr(2).
+struct SchedAttr
+{
+  uint32_t size;
+  uint32_t sched_policy;
+  uint64_t sched_flags;
+  int32_t sched_nice;
+  uint32_t sched_priority;
+  uint64_t sched_runtime;
+  uint64_t sched_deadline;
+  uint64_t sched_period;
+};
+
+static constexpr uint32_t SchedPolicyDeadline = 6;
+static constexpr uint64_t SchedFlagDlOverrun = 0x04;
+
+void ConfigureThisThread(int priority, int cpuCore, bool deadline = false, uint64_t periodNanoseconds = 0)
+{
   // Get the current thread
   pthread_t thisThread = pthread_self();
 
+  if (deadline)
+  {
+    // The kernel's admission control rejects SCHED_DEADLINE tasks whose
+    // affinity mask is narrower than their root domain (EPERM), so the thread
+    // is deliberately not pinned here; isolate cores via cpusets instead when
+    // combining --sched deadline with core isolation.
+    SchedAttr attributes = {};
+    attributes.size = sizeof(attributes);
+    attributes.sched_policy = SchedPolicyDeadline;
+    attributes.sched_flags = SchedFlagDlOverrun;
+    // The cycle's work is a few microseconds; half the period is a generous
+    // budget that still lets EDF preempt us for competing deadline tasks.
+    attributes.sched_runtime = periodNanoseconds / 2;
+    attributes.sched_deadline = periodNanoseconds;
+    attributes.sched_period = periodNanoseconds;
+    if (syscall(__NR_sched_setattr, 0, &attributes, 0) != 0)
+    {
+      throw std::runtime_error(AppendErrorCode("Failed to enter SCHED_DEADLINE"));
+    }
+    return;
+  }
+
+  sched_param sched_params;
+  sched_params.sched_priority = priority;
+
   if (pthread_setschedparam(thisThread, SCHED_FIFO, &sched_params)) {
     std::string errorString = "Failed to set thread priority to " + std::to_string(priority);
     throw std::runtime_error(AppendErrorCode(errorString));
@@ -89,27 +145,35 @@ void ConfigureThisThread(int priority, int cpuCore)
 static constexpr uint64_t RunIndefinitely = std::numeric_limits<uint64_t>::max();
 static constexpr uint64_t NanoPerMicro = 1000;
 
-void AddNanoToTimespec(struct timespec* time, const uint64_t nanos)
-{
-  // Combine both second and nanosecond components into a single time value in nanoseconds
-  // This is to account for rollover when the nanosecond component grows larger than a second
-  // and we must instead increase the second component and reset the nanosecond component.
-  const uint64_t nanoEpoch = Evaluator::ToEpoch(*time) + nanos;
-
-  // Calculate the seconds component by doing integer division (dropping the fractional component)
-  time->tv_sec = nanoEpoch / Evaluator::NanoPerSec;
-
-  // Put the remainder within the nanosecond component.
-  time->tv_nsec = nanoEpoch % Evaluator::NanoPerSec;
-}
-
 void SenderThread(TestParameters params, std::shared_ptr<INicTest> tester)
 {
   try
   {
-    ConfigureThisThread(params.SendPriority, params.SendCpu);
+    ConfigureThisThread(params.SendPriority, params.SendCpu, params.DeadlineSched,
+      static_cast<uint64_t>(params.SendSleep));
+    if (params.SendPerf != nullptr)
+    {
+      params.SendPerf->Open(); // counters follow this now-pinned thread
+    }
 
-    TimerReport report(params.SendSleep, params.BucketWidth, params.SendData);
+    TimerReport report(params.SendSleep, params.BucketWidth, params.SendData, params.SendHistogram,
+      params.Percentiles, params.SendWindows);
+    if (params.DeadlineSched)
+    {
+      report.SetDeadlineMissCounter(&deadlineOverruns);
+    }
+    if (params.SendBaseline != nullptr)
+    {
+      report.RestoreBaseline(*params.SendBaseline);
+    }
+    // Cycle decomposition: wakeup latency (wake minus the absolute deadline)
+    // and work duration (wake to post-Send timestamp). Target 0 — both are
+    // absolute durations, not deviations from a period. Costs one extra
+    // GetCurrentTime per cycle, so it is only armed when the slots are wired.
+    TimerReport wakeupReport(0, params.BucketWidth, params.WakeupData);
+    TimerReport workReport(0, params.BucketWidth, params.WorkData);
+    const bool decompose = params.WakeupData != nullptr || params.WorkData != nullptr;
+    uint64_t wakeTime = 0;
     bool recordTime = true;
     uint64_t index = 0;
     struct timespec next = {};
@@ -119,7 +183,7 @@ void SenderThread(TestParameters params, std::shared_ptr<INicTest> tester)
     {
       // decide whether to record this iteration's time
       recordTime = (index != 0 && index != (params.Iterations -1));
-  
+
       // call the desired method
       if (tester != nullptr)
       {
@@ -131,8 +195,26 @@ void SenderThread(TestParameters params, std::shared_ptr<INicTest> tester)
       if (recordTime)
       {
         report.AddObservation(current - previous, index);
+        if (decompose && wakeTime != 0)
+        {
+          // Send() ran first thing after the wake taken at the end of the
+          // previous loop pass, so wake-to-now is this cycle's work time.
+          workReport.AddObservation(current - wakeTime, index);
+        }
+        if (params.Recorder != nullptr)
+        {
+          params.Recorder->RecordSend(index, current - previous);
+        }
+        if (params.Outliers != nullptr)
+        {
+          params.Outliers->NoteSend(index, current - previous);
+        }
+        if (params.SendPerf != nullptr)
+        {
+          params.SendPerf->RecordCycle(current - previous);
+        }
       }
-  
+
       // Set up the next time to wake up
       AddNanoToTimespec(&next, params.SendSleep);
       // If we are falling behind, skip ahead.
@@ -142,6 +224,16 @@ void SenderThread(TestParameters params, std::shared_ptr<INicTest> tester)
       }
       clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, nullptr);
 
+      if (decompose)
+      {
+        wakeTime = Evaluator::GetCurrentTime();
+        const uint64_t deadline = Evaluator::ToEpoch(next);
+        if (recordTime && wakeTime >= deadline)
+        {
+          wakeupReport.AddObservation(wakeTime - deadline, index);
+        }
+      }
+
       previous = current;
       ++index;
     }
@@ -159,8 +251,17 @@ void ReceiverThread(TestParameters params, std::shared_ptr<INicTest> tester)
   try
   {
     ConfigureThisThread(params.ReceivePriority, params.ReceiveCpu);
+    if (params.ReceivePerf != nullptr)
+    {
+      params.ReceivePerf->Open(); // counters follow this now-pinned thread
+    }
 
-    TimerReport report(params.SendSleep, params.BucketWidth, params.ReceiveData);
+    TimerReport report(params.SendSleep, params.BucketWidth, params.ReceiveData, params.ReceiveHistogram,
+      params.Percentiles, params.ReceiveWindows);
+    if (params.ReceiveBaseline != nullptr)
+    {
+      report.RestoreBaseline(*params.ReceiveBaseline);
+    }
     bool recordTime = true;
 
     uint64_t index = 0;
@@ -182,6 +283,18 @@ void ReceiverThread(TestParameters params, std::shared_ptr<INicTest> tester)
       if (recordTime)
       {
         report.AddObservation(current - previous, index);
+        if (params.Recorder != nullptr)
+        {
+          params.Recorder->RecordReceive(index, current - previous);
+        }
+        if (params.Outliers != nullptr)
+        {
+          params.Outliers->NoteReceive(index, current - previous);
+        }
+        if (params.ReceivePerf != nullptr)
+        {
+          params.ReceivePerf->RecordCycle(current - previous);
+        }
       }
 
       previous = current;
@@ -195,33 +308,6 @@ void ReceiverThread(TestParameters params, std::shared_ptr<INicTest> tester)
   }
 }
 
-// Write a trace marker to be read via trace-cmd
-void WriteTraceMarker(const std::string& message)
-{
-  // Newer path; older kernels use /sys/kernel/debug/tracing/trace_marker
-  const char* paths[] =
-  {
-    "/sys/kernel/tracing/trace_marker",
-    "/sys/kernel/debug/tracing/trace_marker"
-  };
-  int fileDescriptor = -1;
-  for (const char* path : paths)
-  {
-    fileDescriptor = open(path, O_WRONLY | O_CLOEXEC);
-    if (fileDescriptor >= 0) { break; }
-  }
-  if (fileDescriptor < 0)
-  {
-    perror("open trace_marker");
-    return;
-  }
-  if (write(fileDescriptor, message.c_str(), message.size()) < 0)
-  {
-    perror("write trace_marker");
-  }
-  close(fileDescriptor);
-}
-
 class FileDescriptor
 {
 public:
@@ -295,15 +381,30 @@ FileDescriptor SetLatencyTarget()
   return latencyTargetFd;
 }
 
-using ReportPair = std::pair<std::string_view, ReportData*>;
+using ReportPair = std::pair<std::string_view, ReportSlot*>;
 using ReportVector = std::vector<ReportPair>;
 
 void PrintReport(ReportVector& reports, int& lineCount, Evaluator::TableMaker& tableMaker,
   std::chrono::steady_clock::time_point startTime, std::chrono::steady_clock::time_point endTime,
   std::ostream& stream)
 {
+  // Take one consistent snapshot per row up front; everything below renders
+  // from the copies so the table can never mix data from different cycles.
+  std::vector<ReportData> snapshots;
+  snapshots.reserve(reports.size());
+  std::vector<std::pair<std::string_view, ReportData*>> snapshotPairs;
+  snapshotPairs.reserve(reports.size());
+  for (auto [label, slot] : reports)
+  {
+    if (slot != nullptr)
+    {
+      snapshots.push_back(slot->Read());
+      snapshotPairs.push_back({label, &snapshots.back()});
+    }
+  }
+
   // Recalculate column widths based on actual data
-  tableMaker.OptimizeColumnWidthsFromData(reports);
+  tableMaker.OptimizeColumnWidthsFromData(snapshotPairs);
 
   // Move cursor up and clear from cursor to end of screen
   if (lineCount > 0)
@@ -317,14 +418,11 @@ void PrintReport(ReportVector& reports, int& lineCount, Evaluator::TableMaker& t
   lineCount += tableMaker.PrintLabels(stream);
 
   std::stringstream summary;
-  for (auto [label, dataPtr] : reports)
+  for (auto [label, dataPtr] : snapshotPairs)
   {
-    if (dataPtr != nullptr)
-    {
-      lineCount += tableMaker.PrintRow(label, *dataPtr, stream);
-      tableMaker.PrintMaxLatencySummary(summary, label, *dataPtr);
-      lineCount += 1;
-    }
+    lineCount += tableMaker.PrintRow(label, *dataPtr, stream);
+    tableMaker.PrintMaxLatencySummary(summary, label, *dataPtr);
+    lineCount += 1;
   }
   lineCount += Evaluator::FormatDuration(startTime, endTime);
   stream << summary.str();
@@ -332,19 +430,337 @@ void PrintReport(ReportVector& reports, int& lineCount, Evaluator::TableMaker& t
   lineCount += 2;
 }
 
+// Live table renderer for ReportThread. PrintReport re-renders the whole
+// table and pushes dozens of small ostream writes per tick, which visibly
+// lags over SSH and taxes the housekeeping core; this renderer formats the
+// frame into one reusable buffer, diffs it line by line against the previous
+// tick, and emits a single write() that repaints only the lines that changed.
+// Column widths are only re-optimized when a value actually outgrows its
+// column, which forces the one full repaint that realigning requires.
+class LiveRenderer
+{
+public:
+  void RenderFrame(ReportVector& reports, int& lineCount, TableMaker& tableMaker,
+    std::chrono::steady_clock::time_point startTime, std::chrono::steady_clock::time_point endTime,
+    std::ostream& stream)
+  {
+    // Same consistent up-front snapshot PrintReport takes.
+    std::vector<ReportData> snapshots;
+    snapshots.reserve(reports.size());
+    std::vector<std::pair<std::string_view, ReportData*>> snapshotPairs;
+    snapshotPairs.reserve(reports.size());
+    for (auto [label, slot] : reports)
+    {
+      if (slot != nullptr)
+      {
+        snapshots.push_back(slot->Read());
+        snapshotPairs.push_back({label, &snapshots.back()});
+      }
+    }
+
+    bool fullRedraw = previousLines.empty();
+    if (!tableMaker.ColumnWidthsFit(snapshotPairs))
+    {
+      tableMaker.OptimizeColumnWidthsFromData(snapshotPairs);
+      fullRedraw = true;
+    }
+
+    // Format the complete frame in PrintReport's layout: header, rows,
+    // duration, per-row max summaries, trailing blank line.
+    formatter.str(std::string());
+    tableMaker.PrintLabels(formatter);
+    std::stringstream summary;
+    for (auto [label, dataPtr] : snapshotPairs)
+    {
+      tableMaker.PrintRow(label, *dataPtr, formatter);
+      tableMaker.PrintMaxLatencySummary(summary, label, *dataPtr);
+    }
+    Evaluator::FormatDuration(startTime, endTime, formatter);
+    formatter << summary.str();
+    formatter << "\n";
+    SplitLines(formatter.str(), currentLines);
+
+    output.clear();
+    if (!fullRedraw && currentLines.size() != previousLines.size())
+    {
+      fullRedraw = true;
+    }
+    if (fullRedraw)
+    {
+      if (!previousLines.empty())
+      {
+        output += "\033[" + std::to_string(previousLines.size()) + "A\033[J";
+      }
+      for (const std::string& line : currentLines)
+      {
+        output += line;
+        output += '\n';
+      }
+    }
+    else
+    {
+      // The cursor sits on the row just below the frame, so line i is
+      // (size - i) rows up. Repaint changed lines in place and return.
+      for (size_t line = 0; line < currentLines.size(); ++line)
+      {
+        if (currentLines[line] == previousLines[line])
+        {
+          continue;
+        }
+        const std::string rowsUp = std::to_string(currentLines.size() - line);
+        output += "\033[" + rowsUp + "A\r\033[2K";
+        output += currentLines[line];
+        output += "\033[" + rowsUp + "B\r";
+      }
+    }
+
+    if (!output.empty())
+    {
+      stream.write(output.data(), static_cast<std::streamsize>(output.size()));
+      stream.flush();
+    }
+    previousLines.swap(currentLines);
+    lineCount = static_cast<int>(previousLines.size());
+  }
+
+private:
+  static void SplitLines(const std::string& text, std::vector<std::string>& lines)
+  {
+    lines.clear();
+    size_t start = 0;
+    while (start < text.size())
+    {
+      const size_t end = text.find('\n', start);
+      if (end == std::string::npos)
+      {
+        lines.push_back(text.substr(start));
+        break;
+      }
+      lines.push_back(text.substr(start, end - start));
+      start = end + 1;
+    }
+  }
+
+  std::ostringstream formatter;
+  std::vector<std::string> currentLines;
+  std::vector<std::string> previousLines;
+  std::string output;
+};
+
 // live reporter interval at 20Hz
 static constexpr auto ReportInterval = std::chrono::milliseconds(50);
 void ReportThread(ReportVector& reports, int& lineCount, Evaluator::TableMaker& tableMaker,
-  std::chrono::steady_clock::time_point startTime, std::atomic_bool& liveReport, std::ostream& stream)
+  std::chrono::steady_clock::time_point startTime, std::atomic_bool& liveReport, std::ostream& stream,
+  StatsSegment* statsSegment = nullptr, bool quiet = false)
 {
+  LiveRenderer renderer;
   while(liveReport.load(std::memory_order_acquire))
   {
     std::unique_lock lock(reportMutex);
     auto currentTime = std::chrono::steady_clock::now();
-    PrintReport(reports, lineCount, tableMaker, startTime, currentTime, stream);
+    if (statsSegment != nullptr)
+    {
+      statsSegment->Publish();
+    }
+    if (!quiet)
+    {
+      renderer.RenderFrame(reports, lineCount, tableMaker, startTime, currentTime, stream);
+    }
     std::this_thread::sleep_for(ReportInterval);
   }
 }
+// One NIC under test: its parameters, live report slots, optional histograms,
+// and backend instance. The slots contain atomics, so sessions are
+// heap-allocated and never moved once the RT threads hold pointers into them.
+struct NicSession
+{
+  TestParameters Params;
+  ReportSlot SendData, ReceiveData, HardwareData, SoftwareData, WireData, WakeupData, WorkData;
+  WindowSlots SendWindows, ReceiveWindows;
+  std::unique_ptr<Histogram> SendHistogram, ReceiveHistogram;
+  std::unique_ptr<PerfCounters> SendPerf, ReceivePerf;
+  std::shared_ptr<INicTest> Tester;
+  // Row labels live here because ReportVector only holds string_views.
+  std::string SenderLabel, ReceiverLabel, HardwareLabel, SoftwareLabel, WireLabel, WakeupLabel, WorkLabel;
+  std::string SenderOneMinuteLabel, SenderTenMinuteLabel, ReceiverOneMinuteLabel, ReceiverTenMinuteLabel;
+};
+
+// One cyclic measurement thread of an --smp run. Same lifetime rule as
+// NicSession: the slot contains atomics, so cores are heap-allocated and
+// never moved once their RT thread holds a pointer into them.
+struct SmpCore
+{
+  TestParameters Params;
+  ReportSlot Data;
+  // Row label lives here because ReportVector only holds string_views.
+  std::string Label;
+};
+
+// One phase of a --sweep run: the period it ran at and the final snapshots.
+struct SweepOutcome
+{
+  uint64_t PeriodNanoseconds = 0;
+  ReportData Sender;
+  ReportData Receiver; // zero observations on cyclic-only sweeps
+};
+
+// Run the configured periods back-to-back in one process and print a
+// comparative matrix plus a verdict of the highest sustainable sample rate.
+// The backend (and its socket) is created once and reused across phases; the
+// per-phase TimerReports are constructed fresh inside the RT threads, so no
+// state leaks between periods. A phase counts as sustainable when every cycle
+// lands in the Great bucket, i.e. jitter stays under one bucket width
+// (period/8 by default — the documented RMP threshold, e.g. <125 us at 1 kHz).
+int RunSweep(TestParameters params, const std::vector<int32_t>& periodsMicroseconds,
+  uint64_t explicitBucketWidth, bool hasNic)
+{
+  // When no iteration count is given, size each phase to a fixed wall time so
+  // faster rates get proportionally more cycles.
+  static constexpr uint64_t DefaultPhaseSeconds = 30;
+
+  ReportSlot hardwareData, softwareData;
+  std::shared_ptr<INicTest> tester;
+  if (hasNic)
+  {
+    tester = CreateNicTest(params,
+      TimerReport(params.SendSleep, params.BucketWidth, &hardwareData),
+      TimerReport(params.SendSleep, params.BucketWidth, &softwareData));
+  }
+
+  std::vector<SweepOutcome> outcomes;
+  for (size_t phase = 0; phase < periodsMicroseconds.size(); ++phase)
+  {
+    TestParameters phaseParams = params;
+    phaseParams.SendSleep = periodsMicroseconds[phase] * NanoPerMicro;
+    phaseParams.BucketWidth = explicitBucketWidth != 0 ? explicitBucketWidth : phaseParams.SendSleep / 8;
+    if (params.Iterations == RunIndefinitely)
+    {
+      phaseParams.Iterations = DefaultPhaseSeconds * NanoPerSec / phaseParams.SendSleep;
+    }
+    ReportSlot sendData, receiveData;
+    phaseParams.SendData = &sendData;
+    phaseParams.ReceiveData = &receiveData;
+
+    // FormatDuration leaves a '0' fill character on the stream.
+    std::cout << std::setfill(' ') << "Sweep phase " << (phase + 1) << "/" << periodsMicroseconds.size() << ": period "
+              << periodsMicroseconds[phase] << " us, " << phaseParams.Iterations << " iterations ("
+              << GetEstimatedRunTime(phaseParams.Iterations, phaseParams.SendSleep) << ")\n";
+
+    ReportVector reports;
+    reports.push_back({hasNic ? "Sender" : "Cyclic", &sendData});
+    if (hasNic)
+    {
+      reports.push_back({"Receiver", &receiveData});
+    }
+    TableMaker tableMaker = TableMaker::CreateTableMaker(phaseParams.BucketWidth, params.IsVerbose,
+      params.Percentiles, params.DeadlineSched);
+    tableMaker.OptimizeRowLabelWidth(reports);
+
+    testRunning.store(true, std::memory_order_release);
+    std::atomic<bool> liveReport = true;
+    int lineCount = 0;
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::thread receiverThread;
+    if (hasNic)
+    {
+      receiverThread = std::thread(ReceiverThread, phaseParams, tester);
+    }
+    std::thread senderThread(SenderThread, phaseParams, tester);
+    std::thread reportThread(ReportThread, std::ref(reports), std::ref(lineCount), std::ref(tableMaker),
+      startTime, std::ref(liveReport), std::ref(std::cout), nullptr, false);
+
+    if (receiverThread.joinable())
+    {
+      receiverThread.join();
+      testRunning.store(false, std::memory_order_release);
+      senderThread.join();
+    }
+    else
+    {
+      senderThread.join();
+      testRunning.store(false, std::memory_order_release);
+    }
+    liveReport.store(false, std::memory_order_release);
+    reportThread.join();
+
+    std::cout << std::flush;
+    PrintReport(reports, lineCount, tableMaker, startTime, std::chrono::steady_clock::now(), std::cout);
+
+    SweepOutcome outcome;
+    outcome.PeriodNanoseconds = phaseParams.SendSleep;
+    outcome.Sender = sendData.Read();
+    outcome.Receiver = receiveData.Read();
+    outcomes.push_back(outcome);
+  }
+
+  std::cout << std::setfill(' ') << "Sweep summary:\n"
+            << "| Period |   Stream |     Count |     Great |      Good |      Poor |       Bad |  Pathetic |  Max us |    index |\n";
+  auto printSummaryRow = [](uint64_t periodNanoseconds, const char* stream, const ReportData& data)
+  {
+    if (data.observations == 0)
+    {
+      return;
+    }
+    std::cout << "| " << std::setw(6) << periodNanoseconds / NanoPerMicro << " | "
+              << std::setw(8) << stream << " | " << std::setw(9) << data.observations << " |";
+    for (size_t bucket = 0; bucket < BucketCount; ++bucket)
+    {
+      std::cout << " ";
+      if (data.buckets[bucket] > 0)
+      {
+        std::cout << BucketColorScheme::GetColor(bucket) << std::setw(9) << data.buckets[bucket]
+                  << BucketColorScheme::GetResetColor();
+      }
+      else
+      {
+        std::cout << std::setw(9) << data.buckets[bucket];
+      }
+      std::cout << " |";
+    }
+    std::cout << " " << std::setw(7) << data.max / NanoPerMicro << " | " << std::setw(8) << data.maxIndex << " |\n";
+  };
+  for (const SweepOutcome& outcome : outcomes)
+  {
+    printSummaryRow(outcome.PeriodNanoseconds, hasNic ? "Sender" : "Cyclic", outcome.Sender);
+    printSummaryRow(outcome.PeriodNanoseconds, "Receiver", outcome.Receiver);
+  }
+
+  auto sustainable = [](const ReportData& data)
+  {
+    for (size_t bucket = 1; bucket < BucketCount; ++bucket)
+    {
+      if (data.buckets[bucket] > 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+  const SweepOutcome* best = nullptr;
+  for (const SweepOutcome& outcome : outcomes)
+  {
+    if (outcome.Sender.observations == 0 || !sustainable(outcome.Sender) || !sustainable(outcome.Receiver))
+    {
+      continue;
+    }
+    if (best == nullptr || outcome.PeriodNanoseconds < best->PeriodNanoseconds)
+    {
+      best = &outcome;
+    }
+  }
+  if (best != nullptr)
+  {
+    std::cout << "Sweep verdict: highest sustainable rate " << NanoPerSec / best->PeriodNanoseconds
+              << " Hz (" << best->PeriodNanoseconds / NanoPerMicro
+              << " us period): every cycle stayed within one bucket width of target.\n";
+  }
+  else
+  {
+    std::cout << "Sweep verdict: no swept period kept every cycle within one bucket width of target.\n";
+  }
+  return 0;
+}
 } // end namespace Evaluator
 
 
@@ -371,25 +787,71 @@ int main(int argc, char* argv[])
     params.ReceiveCpu = DefaultCpuCore;
     params.IsVerbose = false;
     params.BucketWidth = AutomaticBucketWidth;
-    Evaluator::ReportData sendData, receiveData, hardwareData, softwareData;
+    Evaluator::ReportSlot sendData, receiveData;
     params.SendData = &sendData;
     params.ReceiveData = &receiveData;
+    // Sender cycle decomposition slots, wired only under --verbose since the
+    // split costs an extra clock read per cycle.
+    Evaluator::ReportSlot wakeupData, workData;
 
     bool noConfig = false;
 
     std::atomic<bool> liveReport = true;
 
     std::vector<Evaluator::Argument> arguments;
-    Evaluator::AddArgument(arguments, {"--nic", "-n"}, &params.NicName, "Network interface card name");
+    std::vector<std::string> nicNames;
+    Evaluator::AddArgument(arguments, {"--nic", "-n"}, &nicNames, "Network interface card name (repeat the flag to test multiple NICs concurrently)");
+    Evaluator::AddArgument(arguments, {"--backend"}, &params.Backend, "NIC test backend: raw (PF_PACKET socket), ring (PACKET_MMAP rings), or xdp (AF_XDP zero-copy)");
     Evaluator::AddArgument(arguments, {"--iterations", "-i"}, &params.Iterations, "Number of iterations");
     Evaluator::AddArgument(arguments, {"--send-sleep", "-s"}, &params.SendSleep, "Send sleep duration in microseconds");
     Evaluator::AddArgument(arguments, {"--send-priority", "-sp"}, &params.SendPriority, "Send thread priority");
     Evaluator::AddArgument(arguments, {"--receive-priority", "-rp"}, &params.ReceivePriority, "Receive thread priority");
-    Evaluator::AddArgument(arguments, {"--send-cpu", "-sc"}, &params.SendCpu, "CPU core to use for the sender thread");
-    Evaluator::AddArgument(arguments, {"--receive-cpu", "-rc"}, &params.ReceiveCpu, "CPU core to use for the receiver thread");
+    std::vector<int32_t> sendCpus, receiveCpus;
+    Evaluator::AddArgument(arguments, {"--send-cpu", "-sc"}, &sendCpus, "CPU core to use for the sender thread (repeat for per-NIC assignment)");
+    Evaluator::AddArgument(arguments, {"--receive-cpu", "-rc"}, &receiveCpus, "CPU core to use for the receiver thread (repeat for per-NIC assignment)");
     Evaluator::AddArgument(arguments, {"--verbose", "-v"}, &params.IsVerbose, "Enable verbose output");
+    bool recordHistogram = false;
+    Evaluator::AddArgument(arguments, {"--histogram"}, &recordHistogram, "Record a full HDR histogram per thread and dump it with p99/p99.9/p99.99 at the end");
+    std::string recordFile;
+    Evaluator::AddArgument(arguments, {"--record"}, &recordFile, "Stream every cycle's (index, observation) pair to the given file in binary form");
+    uint64_t traceThreshold = 0;
+    Evaluator::AddArgument(arguments, {"--trace-threshold"}, &traceThreshold, "On any cycle beyond this many microseconds, write an ftrace marker and append a /proc/interrupts snapshot to rmp-eval-outliers.log");
+    bool traceFreeze = false;
+    Evaluator::AddArgument(arguments, {"--trace-freeze"}, &traceFreeze, "Also write 0 to tracing_on at the first outlier to freeze a running ftrace capture at the event");
     Evaluator::AddArgument(arguments, {"--no-config", "-nc"}, &noConfig, "Skip system configuration checks");
+    bool tuneSystem = false;
+    Evaluator::AddArgument(arguments, {"--tune"}, &tuneSystem, "Apply safe, reversible fixes for failed checks (governor, NIC IRQ affinity, RPS, timer migration, NIC coalescing) and restore prior values at exit");
     Evaluator::AddArgument(arguments, {"--bucket-width", "-b"}, &params.BucketWidth, "Bucket width in microseconds for counting occurrences.");
+    Evaluator::AddArgument(arguments, {"--datagrams", "-d"}, &params.Datagrams, "Number of BRD sub-datagrams per probe frame (1-115)");
+    Evaluator::AddArgument(arguments, {"--burst"}, &params.Burst, "Frames per cycle (raw backend, 1-64): move the burst with one sendmmsg/recvmmsg each way to measure throughput headroom");
+    Evaluator::AddArgument(arguments, {"--busy-poll"}, &params.BusyPoll, "Spin on the receive socket instead of sleeping in poll() (burns the receive core)");
+    Evaluator::AddArgument(arguments, {"--percentiles", "-p"}, &params.Percentiles, "Track p99/p99.9/p99.99 in one pass and show them as table columns");
+    bool windowStats = false;
+    Evaluator::AddArgument(arguments, {"--window", "-w"}, &windowStats, "Also aggregate into rolling windows and show last-1m/last-10m rows (soak testing)");
+    bool perfCounters = false;
+    Evaluator::AddArgument(arguments, {"--perf"}, &perfCounters, "Attribute per-cycle perf counter deltas (SMIs, LLC/dTLB misses, context switches) to latency buckets");
+    std::vector<int32_t> sweepPeriods;
+    Evaluator::AddArgument(arguments, {"--sweep"}, &sweepPeriods, "Run this period (microseconds) as one back-to-back sweep phase (repeat the flag; prints a comparative matrix and a sustainability verdict)");
+    bool smpMode = false;
+    Evaluator::AddArgument(arguments, {"--smp", "-S"}, &smpMode, "Run one cyclic thread per isolated core and report a labeled row per core (no NIC; cores from isolcpus)");
+    std::string schedPolicy = "fifo";
+    Evaluator::AddArgument(arguments, {"--sched"}, &schedPolicy, "Sender scheduling policy: fifo (SCHED_FIFO at --send-priority) or deadline (SCHED_DEADLINE with runtime/deadline/period from --send-sleep; adds a Misses column)");
+    std::string clockSource = "system";
+    Evaluator::AddArgument(arguments, {"--clock"}, &clockSource, "Timestamp clock: system (clock_gettime) or tsc (calibrated rdtscp fast path)");
+    bool quiet = false;
+    Evaluator::AddArgument(arguments, {"--quiet", "-q"}, &quiet, "Suppress the live table (the final report still prints); the shared-memory stats stay available");
+    std::string outputFile;
+    Evaluator::AddArgument(arguments, {"--output", "-o"}, &outputFile, "Write results to the given file in JSON or CSV form (chosen by extension)");
+    uint64_t outputIntervalSeconds = 0;
+    Evaluator::AddArgument(arguments, {"--output-interval"}, &outputIntervalSeconds, "Also rewrite the --output file every N seconds so an aborted soak keeps its data");
+    std::string checkpointFile;
+    Evaluator::AddArgument(arguments, {"--checkpoint"}, &checkpointFile, "Periodically snapshot all report state to the given file (written atomically) so a multi-day soak survives a crash or power loss");
+    uint64_t checkpointIntervalSeconds = 10;
+    Evaluator::AddArgument(arguments, {"--checkpoint-interval"}, &checkpointIntervalSeconds, "Seconds between checkpoint writes (default 10)");
+    std::string resumeFile;
+    Evaluator::AddArgument(arguments, {"--resume"}, &resumeFile, "Seed the report state from an earlier --checkpoint file and continue accumulating");
+    std::string loadSpecText;
+    Evaluator::AddArgument(arguments, {"--load"}, &loadSpecText, "Run background load workers (cpu:N,mem:M,io:K) pinned away from the RT cores, so latency-under-load results are reproducible without a side stress-ng");
 
     bool showHelp = false;
     Evaluator::AddArgument(arguments, {"--help", "-h"}, &showHelp, "Show this help message");
@@ -415,9 +877,109 @@ int main(int argc, char* argv[])
       return 0;  // Exit after showing version
     }
 
+    // Resolve the repeatable arguments. The first NIC and its cores stay in
+    // params so the config checks and the single-NIC path behave exactly as
+    // before; additional NICs get their own session below. When fewer cores
+    // than NICs are given, the last one is reused.
+    if (!nicNames.empty())
+    {
+      params.NicName = nicNames.front();
+    }
+    // Default core when none is given: the highest-numbered CPU on the NIC's
+    // NUMA node, so the RT threads land next to the PCIe root complex on
+    // multi-socket hosts instead of one interconnect hop away; the last CPU
+    // overall when there is no NIC or no NUMA information.
+    auto defaultCpuForNic = [&](size_t index) -> int
+    {
+      if (index < nicNames.size())
+      {
+        const auto nodeCpus = Evaluator::GetNodeCpus(Evaluator::GetNicNumaNode(nicNames[index]));
+        if (!nodeCpus.empty())
+        {
+          return nodeCpus.back();
+        }
+      }
+      return static_cast<int>(DefaultCpuCore);
+    };
+    auto cpuForSession = [&](const std::vector<int32_t>& cpus, size_t index)
+    {
+      if (cpus.empty())
+      {
+        return defaultCpuForNic(index);
+      }
+      return static_cast<int>(cpus[std::min(index, cpus.size() - 1)]);
+    };
+    params.SendCpu = cpuForSession(sendCpus, 0);
+    params.ReceiveCpu = cpuForSession(receiveCpus, 0);
+
+    if (!recordFile.empty() && nicNames.size() > 1)
+    {
+      std::cerr << "Error: --record supports a single NIC; the trace file has no per-NIC stream identifier." << std::endl;
+      return 1;
+    }
+
+    if (traceThreshold > 0 && nicNames.size() > 1)
+    {
+      std::cerr << "Error: --trace-threshold supports a single NIC; the outlier mailboxes are single-producer." << std::endl;
+      return 1;
+    }
+
+    if (!sweepPeriods.empty() && nicNames.size() > 1)
+    {
+      std::cerr << "Error: --sweep supports a single NIC." << std::endl;
+      return 1;
+    }
+
+    if (!sweepPeriods.empty() && (!checkpointFile.empty() || !resumeFile.empty()))
+    {
+      std::cerr << "Error: --checkpoint/--resume track one cumulative run and cannot be combined with --sweep." << std::endl;
+      return 1;
+    }
+
+    if (!checkpointFile.empty() && checkpointIntervalSeconds == 0)
+    {
+      std::cerr << "Error: --checkpoint-interval must be at least 1 second." << std::endl;
+      return 1;
+    }
+
+    // --smp resolves the isolated-core list up front so a host without core
+    // isolation fails loudly instead of silently measuring nothing.
+    std::vector<int> smpCores;
+    if (smpMode)
+    {
+      if (!nicNames.empty())
+      {
+        std::cerr << "Error: --smp is cyclic-only; it cannot be combined with --nic." << std::endl;
+        return 1;
+      }
+      if (!sweepPeriods.empty())
+      {
+        std::cerr << "Error: --smp cannot be combined with --sweep." << std::endl;
+        return 1;
+      }
+      if (!recordFile.empty() || traceThreshold > 0 || recordHistogram || windowStats || perfCounters)
+      {
+        std::cerr << "Error: --record, --trace-threshold, --histogram, --window and --perf assume a single cyclic stream and cannot be combined with --smp." << std::endl;
+        return 1;
+      }
+      smpCores = Evaluator::GetIsolatedCpus();
+      if (smpCores.empty())
+      {
+        std::cerr << "Error: --smp found no isolated cores (/sys/devices/system/cpu/isolated is empty and no isolcpus= boot parameter)." << std::endl;
+        return 1;
+      }
+    }
+
+    if (tuneSystem && noConfig)
+    {
+      std::cerr << "Error: --tune remediates failed checks, so it cannot be combined with --no-config." << std::endl;
+      return 1;
+    }
+
+    std::vector<Evaluator::CheckResult> checkResults;
     if (!noConfig)
     {
-      Evaluator::ReportSystemConfiguration(params.SendCpu, params.NicName);
+      checkResults = Evaluator::ReportSystemConfiguration(params.SendCpu, params.NicName);
     }
 
     if (geteuid() != 0)
@@ -426,13 +988,44 @@ int main(int argc, char* argv[])
       return 1;
     }
 
+    // Remediations apply before any RT thread exists and roll back when the
+    // tuner goes out of scope at exit (including on an exception unwind).
+    std::unique_ptr<Evaluator::SystemTuner> tuner;
+    if (tuneSystem)
+    {
+      tuner = std::make_unique<Evaluator::SystemTuner>(checkResults, params.SendCpu,
+        nicNames.empty() ? std::string() : nicNames.front());
+    }
+
     if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
     {
       std::cerr << "Error: Failed to lock memory. Memory swapping might occur. Error: " << strerror(errno) << std::endl;
       return 1;
     }
 
+    // Bias every allocation from here on (socket and frame buffers, report
+    // slots, histograms, sample rings) toward the NIC-local NUMA node: they
+    // are first-touched by this not-yet-pinned thread, so the default policy
+    // could land them a node away from the cores that hammer them. Preferred
+    // rather than bind so an exhausted node degrades to a remote page instead
+    // of failing the allocation. Raw syscall to stay free of libnuma, like
+    // the perf and bpf users elsewhere.
+    if (!nicNames.empty())
+    {
+      const int nicNode = Evaluator::GetNicNumaNode(nicNames.front());
+      if (nicNode >= 0 && nicNode < static_cast<int>(sizeof(unsigned long) * 8))
+      {
+        static constexpr int MemPolicyPreferred = 1; // MPOL_PREFERRED
+        unsigned long nodeMask = 1UL << nicNode;
+        if (syscall(__NR_set_mempolicy, MemPolicyPreferred, &nodeMask, sizeof(nodeMask) * 8) != 0)
+        {
+          std::cerr << "WARN: Failed to prefer NUMA node " << nicNode << " for allocations: " << strerror(errno) << std::endl;
+        }
+      }
+    }
+
     params.SendSleep *= Evaluator::NanoPerMicro; // convert to nanoseconds for internal use
+    const bool autoBucketWidth = params.BucketWidth == AutomaticBucketWidth;
     if (params.BucketWidth == 0)
     {
       params.BucketWidth = params.SendSleep * 0.125;
@@ -442,9 +1035,138 @@ int main(int argc, char* argv[])
       params.BucketWidth *= Evaluator::NanoPerMicro; // convert to nanoseconds for internal use
     }
 
+    // Resumed checkpoint state is loaded before any RT thread exists and
+    // stays alive in this scope: the TimerReports hold pointers into it while
+    // they seed themselves.
+    Evaluator::CheckpointState resumedState;
+    if (!resumeFile.empty())
+    {
+      resumedState = Evaluator::LoadCheckpoint(resumeFile);
+      if (resumedState.PeriodNanoseconds != static_cast<uint64_t>(params.SendSleep))
+      {
+        std::cerr << "Error: the --resume checkpoint was taken at a "
+                  << resumedState.PeriodNanoseconds / Evaluator::NanoPerMicro
+                  << " us period but this run uses " << params.SendSleep / Evaluator::NanoPerMicro
+                  << " us; the accumulated buckets are not comparable." << std::endl;
+        return 1;
+      }
+    }
+
+    if (schedPolicy == "deadline")
+    {
+      params.DeadlineSched = true;
+      // SCHED_FLAG_DL_OVERRUN delivers SIGXCPU to the thread on each missed
+      // deadline; the handler just counts, and the count surfaces as the
+      // Misses column. Installed before any RT thread exists.
+      struct sigaction action = {};
+      action.sa_handler = Evaluator::OnDeadlineOverrun;
+      sigemptyset(&action.sa_mask);
+      if (sigaction(SIGXCPU, &action, nullptr) != 0)
+      {
+        std::cerr << "Error: Failed to install the SIGXCPU handler: " << strerror(errno) << std::endl;
+        return 1;
+      }
+    }
+    else if (schedPolicy != "fifo")
+    {
+      std::cerr << "Error: Unknown scheduling policy '" << schedPolicy << "'. Use fifo or deadline." << std::endl;
+      return 1;
+    }
+
+    // Switch the timestamp clock before any thread reads it, so every
+    // observation in a run comes from the same clock.
+    if (clockSource == "tsc")
+    {
+      try
+      {
+        Evaluator::EnableTscClock();
+      }
+      catch (const std::exception& error)
+      {
+        std::cerr << "Error: " << error.what() << std::endl;
+        return 1;
+      }
+    }
+    else if (clockSource != "system")
+    {
+      std::cerr << "Error: Unknown clock '" << clockSource << "'. Use system or tsc." << std::endl;
+      return 1;
+    }
+
+    // Allocate histogram storage before the RT loop starts so the arrays are
+    // covered by the mlockall above and never fault on the hot path. NIC
+    // sessions own their histograms; this one serves the cyclic-only path.
+    std::unique_ptr<Evaluator::Histogram> cyclicHistogram;
+    if (recordHistogram && nicNames.empty())
+    {
+      cyclicHistogram = std::make_unique<Evaluator::Histogram>();
+      params.SendHistogram = cyclicHistogram.get();
+    }
+
+    // Window slots for the cyclic-only path; NIC sessions own theirs.
+    std::unique_ptr<Evaluator::WindowSlots> cyclicWindows;
+    if (windowStats && nicNames.empty())
+    {
+      cyclicWindows = std::make_unique<Evaluator::WindowSlots>();
+      params.SendWindows = cyclicWindows.get();
+    }
+
+    // Perf counters for the cyclic-only path; the RT thread opens them after
+    // pinning itself so they follow the right core.
+    std::unique_ptr<Evaluator::PerfCounters> cyclicPerf;
+    if (perfCounters && nicNames.empty())
+    {
+      cyclicPerf = std::make_unique<Evaluator::PerfCounters>(params.SendSleep, params.BucketWidth);
+      params.SendPerf = cyclicPerf.get();
+    }
+
+    // The sample rings are preallocated here, before the RT threads start, so
+    // the mlockall above covers them; the drainer thread streams to disk off
+    // the isolated cores.
+    std::unique_ptr<Evaluator::SampleRecorder> recorder;
+    if (!recordFile.empty())
+    {
+      recorder = std::make_unique<Evaluator::SampleRecorder>(recordFile, params.SendSleep, CLOCK_MONOTONIC);
+      params.Recorder = recorder.get();
+    }
+
+    // Outlier mailboxes are preallocated here for the same reason; the helper
+    // thread does all its file I/O off the isolated cores.
+    std::unique_ptr<Evaluator::OutlierTracer> outlierTracer;
+    if (traceThreshold > 0)
+    {
+      outlierTracer = std::make_unique<Evaluator::OutlierTracer>("rmp-eval-outliers.log",
+        traceThreshold * Evaluator::NanoPerMicro, traceFreeze);
+      params.Outliers = outlierTracer.get();
+    }
+
     auto latencyFd = Evaluator::SetLatencyTarget();
 
-    Evaluator::TableMaker tableMaker = Evaluator::TableMaker::CreateTableMaker(params.BucketWidth, params.IsVerbose);
+    // Background load starts before the sweep or the RT threads, so every
+    // phase of the run sees the same pressure. Every core an RT thread could
+    // land on is reserved; the workers spread over whatever remains.
+    std::unique_ptr<Evaluator::LoadGenerator> loadGenerator;
+    if (!loadSpecText.empty())
+    {
+      std::vector<int> reservedCores = {params.SendCpu, params.ReceiveCpu};
+      for (size_t nicIndex = 1; nicIndex < nicNames.size(); ++nicIndex)
+      {
+        reservedCores.push_back(cpuForSession(sendCpus, nicIndex));
+        reservedCores.push_back(cpuForSession(receiveCpus, nicIndex));
+      }
+      reservedCores.insert(reservedCores.end(), smpCores.begin(), smpCores.end());
+      loadGenerator = std::make_unique<Evaluator::LoadGenerator>(
+        Evaluator::LoadSpec::Parse(loadSpecText), reservedCores);
+      std::cout << "Background load: " << loadGenerator->Description() << "\n";
+    }
+
+    if (!sweepPeriods.empty())
+    {
+      return Evaluator::RunSweep(params, sweepPeriods, autoBucketWidth ? 0 : params.BucketWidth, !nicNames.empty());
+    }
+
+    Evaluator::TableMaker tableMaker = Evaluator::TableMaker::CreateTableMaker(params.BucketWidth, params.IsVerbose,
+      params.Percentiles, params.DeadlineSched);
 
     if (params.Iterations != Evaluator::RunIndefinitely)
     {
@@ -456,50 +1178,276 @@ int main(int argc, char* argv[])
 
     int lineCount = 0;
     Evaluator::ReportVector reports;
+    std::vector<std::unique_ptr<Evaluator::NicSession>> sessions;
+    std::vector<std::unique_ptr<Evaluator::SmpCore>> smpSessions;
+    // Declared after the sessions so it is destroyed (and takes its final
+    // snapshot) while the report slots are still alive.
+    std::unique_ptr<Evaluator::ResultsWriter> resultsWriter;
+    // Live-stats mirror for external dashboards; created once the row set is
+    // known. Failure to create it (e.g. read-only /dev/shm) is not fatal.
+    std::unique_ptr<Evaluator::StatsSegment> statsSegment;
+    // Periodic durable snapshot of the same rows (--checkpoint); a write
+    // failure at startup is fatal so a doomed soak stops at minute zero.
+    std::unique_ptr<Evaluator::CheckpointWriter> checkpointWriter;
+    auto createStatsSegment = [&]()
+    {
+      try
+      {
+        statsSegment = std::make_unique<Evaluator::StatsSegment>("/dev/shm/rmp-eval", reports, params.SendSleep);
+      }
+      catch (const std::exception& error)
+      {
+        std::cerr << "WARN: " << error.what() << std::endl;
+      }
+    };
 
     auto startTime = std::chrono::steady_clock::now();
+    if (!resumeFile.empty())
+    {
+      // Continue the elapsed clock (Duration line and checkpoint header)
+      // across the restart instead of starting it over.
+      startTime -= std::chrono::nanoseconds(resumedState.ElapsedNanoseconds);
+    }
 
-    if (params.NicName == NoNicSelected)
+    auto createCheckpointWriter = [&]()
     {
-      reports.push_back({"Cyclic", &sendData});
+      if (!checkpointFile.empty())
+      {
+        checkpointWriter = std::make_unique<Evaluator::CheckpointWriter>(checkpointFile, reports,
+          static_cast<uint64_t>(params.SendSleep), std::chrono::seconds(checkpointIntervalSeconds), startTime);
+      }
+    };
+
+    if (nicNames.empty())
+    {
+      if (smpMode)
+      {
+        // One measurement thread per isolated core, each with its own slot
+        // and a "Cyclic/<core>" row. Per-core results routinely differ by
+        // 2-3x on hybrid P/E-core parts, so one averaged row would hide the
+        // worst core.
+        for (int core : smpCores)
+        {
+          auto session = std::make_unique<Evaluator::SmpCore>();
+          session->Params = params;
+          session->Params.SendCpu = core;
+          session->Params.SendData = &session->Data;
+          session->Label = "Cyclic/" + std::to_string(core);
+          session->Params.SendBaseline = resumedState.Find(session->Label);
+          reports.push_back({session->Label, &session->Data});
+          smpSessions.push_back(std::move(session));
+        }
+      }
+      else
+      {
+        reports.push_back({"Cyclic", &sendData});
+        params.SendBaseline = resumedState.Find("Cyclic");
+        if (windowStats)
+        {
+          reports.push_back({"Cyclic 1m", &cyclicWindows->OneMinute});
+          reports.push_back({"Cyclic 10m", &cyclicWindows->TenMinutes});
+        }
+        if (params.IsVerbose)
+        {
+          params.WakeupData = &wakeupData;
+          params.WorkData = &workData;
+          reports.push_back({"Wakeup", &wakeupData});
+          reports.push_back({"Work", &workData});
+        }
+      }
 
       tableMaker.OptimizeRowLabelWidth(reports);
 
-      std::thread cyclicThread(Evaluator::SenderThread, params, nullptr);
+      if (!outputFile.empty())
+      {
+        std::vector<Evaluator::ResultsWriter::Row> outputRows;
+        if (smpMode)
+        {
+          for (const auto& session : smpSessions)
+          {
+            outputRows.push_back({session->Label, &session->Data});
+          }
+        }
+        else
+        {
+          outputRows.push_back({"Cyclic", &sendData});
+          if (params.IsVerbose)
+          {
+            outputRows.push_back({"Wakeup", &wakeupData});
+            outputRows.push_back({"Work", &workData});
+          }
+        }
+        resultsWriter = std::make_unique<Evaluator::ResultsWriter>(outputFile,
+          std::move(outputRows), std::move(checkResults), params.SendSleep,
+          std::chrono::seconds(outputIntervalSeconds),
+          loadGenerator ? loadGenerator->Description() : std::string());
+      }
+
+      createStatsSegment();
+      createCheckpointWriter();
+
+      std::vector<std::thread> cyclicThreads;
+      if (smpMode)
+      {
+        for (const auto& session : smpSessions)
+        {
+          cyclicThreads.emplace_back(Evaluator::SenderThread, session->Params, nullptr);
+        }
+      }
+      else
+      {
+        cyclicThreads.emplace_back(Evaluator::SenderThread, params, nullptr);
+      }
 
       std::thread reportThread(Evaluator::ReportThread, std::ref(reports), std::ref(lineCount), std::ref(tableMaker),
-        startTime, std::ref(liveReport), std::ref(std::cout));
+        startTime, std::ref(liveReport), std::ref(std::cout), statsSegment.get(), quiet);
 
-      cyclicThread.join();
+      for (auto& cyclicThread : cyclicThreads)
+      {
+        cyclicThread.join();
+      }
       testRunning.store(false, std::memory_order_release);
       liveReport.store(false, std::memory_order_release);
       reportThread.join();
     }
     else
     {
-      reports.push_back({"Sender", &sendData});
-      reports.push_back({"Receiver", &receiveData});
-      if (params.IsVerbose)
+      // One session per --nic occurrence. Row labels keep their historical
+      // names for a single NIC and gain the interface name as a prefix when
+      // several run concurrently ("enp2s0 Sender", "enp3s0 Receiver").
+      const bool multiNic = nicNames.size() > 1;
+      for (size_t nicIndex = 0; nicIndex < nicNames.size(); ++nicIndex)
       {
-        reports.push_back({"HW delta", &hardwareData});
-        reports.push_back({"SW delta", &softwareData});
+        auto session = std::make_unique<Evaluator::NicSession>();
+        session->Params = params;
+        session->Params.NicName = nicNames[nicIndex];
+        session->Params.SendCpu = cpuForSession(sendCpus, nicIndex);
+        session->Params.ReceiveCpu = cpuForSession(receiveCpus, nicIndex);
+        session->Params.SendData = &session->SendData;
+        session->Params.ReceiveData = &session->ReceiveData;
+        session->Params.WireData = &session->WireData;
+        if (params.IsVerbose)
+        {
+          session->Params.WakeupData = &session->WakeupData;
+          session->Params.WorkData = &session->WorkData;
+        }
+        if (recordHistogram)
+        {
+          session->SendHistogram = std::make_unique<Evaluator::Histogram>();
+          session->ReceiveHistogram = std::make_unique<Evaluator::Histogram>();
+          session->Params.SendHistogram = session->SendHistogram.get();
+          session->Params.ReceiveHistogram = session->ReceiveHistogram.get();
+        }
+
+        if (windowStats)
+        {
+          session->Params.SendWindows = &session->SendWindows;
+          session->Params.ReceiveWindows = &session->ReceiveWindows;
+        }
+        if (perfCounters)
+        {
+          session->SendPerf = std::make_unique<Evaluator::PerfCounters>(params.SendSleep, params.BucketWidth);
+          session->ReceivePerf = std::make_unique<Evaluator::PerfCounters>(params.SendSleep, params.BucketWidth);
+          session->Params.SendPerf = session->SendPerf.get();
+          session->Params.ReceivePerf = session->ReceivePerf.get();
+        }
+
+        const std::string prefix = multiNic ? nicNames[nicIndex] + " " : "";
+        session->SenderLabel = prefix + "Sender";
+        session->ReceiverLabel = prefix + "Receiver";
+        session->HardwareLabel = prefix + "HW delta";
+        session->SoftwareLabel = prefix + "SW delta";
+        session->WireLabel = prefix + "Wire";
+        session->WakeupLabel = prefix + "Wakeup";
+        session->WorkLabel = prefix + "Work";
+        session->Params.SendBaseline = resumedState.Find(session->SenderLabel);
+        session->Params.ReceiveBaseline = resumedState.Find(session->ReceiverLabel);
+        session->SenderOneMinuteLabel = session->SenderLabel + " 1m";
+        session->SenderTenMinuteLabel = session->SenderLabel + " 10m";
+        session->ReceiverOneMinuteLabel = session->ReceiverLabel + " 1m";
+        session->ReceiverTenMinuteLabel = session->ReceiverLabel + " 10m";
+
+        reports.push_back({session->SenderLabel, &session->SendData});
+        if (windowStats)
+        {
+          reports.push_back({session->SenderOneMinuteLabel, &session->SendWindows.OneMinute});
+          reports.push_back({session->SenderTenMinuteLabel, &session->SendWindows.TenMinutes});
+        }
+        reports.push_back({session->ReceiverLabel, &session->ReceiveData});
+        if (windowStats)
+        {
+          reports.push_back({session->ReceiverOneMinuteLabel, &session->ReceiveWindows.OneMinute});
+          reports.push_back({session->ReceiverTenMinuteLabel, &session->ReceiveWindows.TenMinutes});
+        }
+        if (params.IsVerbose)
+        {
+          reports.push_back({session->HardwareLabel, &session->HardwareData});
+          reports.push_back({session->SoftwareLabel, &session->SoftwareData});
+          if (params.Backend == "raw")
+          {
+            reports.push_back({session->WireLabel, &session->WireData});
+          }
+          reports.push_back({session->WakeupLabel, &session->WakeupData});
+          reports.push_back({session->WorkLabel, &session->WorkData});
+        }
+        sessions.push_back(std::move(session));
       }
 
       tableMaker.OptimizeRowLabelWidth(reports);
 
-      std::shared_ptr<Evaluator::INicTest> tester = std::make_shared<Evaluator::EthercatNicTest>(params, 
-        Evaluator::TimerReport(params.SendSleep, params.BucketWidth, &hardwareData),
-        Evaluator::TimerReport(params.SendSleep, params.BucketWidth, &softwareData));
+      if (!outputFile.empty())
+      {
+        // The output always carries the HW/SW delta rows, even when the live
+        // table hides them; the pipeline should not depend on --verbose.
+        std::vector<Evaluator::ResultsWriter::Row> outputRows;
+        for (const auto& session : sessions)
+        {
+          outputRows.push_back({session->SenderLabel, &session->SendData});
+          outputRows.push_back({session->ReceiverLabel, &session->ReceiveData});
+          outputRows.push_back({session->HardwareLabel, &session->HardwareData});
+          outputRows.push_back({session->SoftwareLabel, &session->SoftwareData});
+          outputRows.push_back({session->WireLabel, &session->WireData});
+          if (params.IsVerbose)
+          {
+            outputRows.push_back({session->WakeupLabel, &session->WakeupData});
+            outputRows.push_back({session->WorkLabel, &session->WorkData});
+          }
+        }
+        resultsWriter = std::make_unique<Evaluator::ResultsWriter>(outputFile,
+          std::move(outputRows), std::move(checkResults), params.SendSleep,
+          std::chrono::seconds(outputIntervalSeconds),
+          loadGenerator ? loadGenerator->Description() : std::string());
+      }
 
-      std::thread receiverThread(Evaluator::ReceiverThread, params, tester);
-      std::thread senderThread(Evaluator::SenderThread, params, tester);
+      for (auto& session : sessions)
+      {
+        session->Tester = Evaluator::CreateNicTest(session->Params,
+          Evaluator::TimerReport(params.SendSleep, params.BucketWidth, &session->HardwareData),
+          Evaluator::TimerReport(params.SendSleep, params.BucketWidth, &session->SoftwareData));
+      }
+
+      createStatsSegment();
+      createCheckpointWriter();
+
+      std::vector<std::thread> receiverThreads, senderThreads;
+      for (auto& session : sessions)
+      {
+        receiverThreads.emplace_back(Evaluator::ReceiverThread, session->Params, session->Tester);
+        senderThreads.emplace_back(Evaluator::SenderThread, session->Params, session->Tester);
+      }
 
       std::thread reportThread(Evaluator::ReportThread, std::ref(reports), std::ref(lineCount), std::ref(tableMaker),
-        startTime, std::ref(liveReport), std::ref(std::cout));
+        startTime, std::ref(liveReport), std::ref(std::cout), statsSegment.get(), quiet);
 
-      receiverThread.join();
+      for (auto& receiverThread : receiverThreads)
+      {
+        receiverThread.join();
+      }
       testRunning.store(false, std::memory_order_release);
-      senderThread.join();
+      for (auto& senderThread : senderThreads)
+      {
+        senderThread.join();
+      }
 
       liveReport.store(false, std::memory_order_release);
       reportThread.join();
@@ -507,8 +1455,65 @@ int main(int argc, char* argv[])
 
     std::cout << std::flush;
     Evaluator::PrintReport(reports, lineCount, tableMaker, startTime, std::chrono::steady_clock::now(), std::cout);
+    if (loadGenerator)
+    {
+      // Restate the load with the final table so a captured report is never
+      // mistaken for idle-system numbers.
+      std::cout << "Background load: " << loadGenerator->Description() << "\n";
+    }
     std::cout << std::flush;
 
+    if (windowStats)
+    {
+      if (nicNames.empty())
+      {
+        Evaluator::PrintSoakRegression("Cyclic", *cyclicWindows);
+      }
+      else
+      {
+        for (const auto& session : sessions)
+        {
+          Evaluator::PrintSoakRegression(session->SenderLabel, session->SendWindows);
+          Evaluator::PrintSoakRegression(session->ReceiverLabel, session->ReceiveWindows);
+        }
+      }
+      std::cout << std::flush;
+    }
+
+    if (perfCounters)
+    {
+      if (nicNames.empty())
+      {
+        cyclicPerf->Print(std::cout, "Cyclic");
+      }
+      else
+      {
+        for (const auto& session : sessions)
+        {
+          session->SendPerf->Print(std::cout, session->SenderLabel);
+          session->ReceivePerf->Print(std::cout, session->ReceiverLabel);
+        }
+      }
+      std::cout << std::flush;
+    }
+
+    if (recordHistogram)
+    {
+      if (nicNames.empty())
+      {
+        cyclicHistogram->Print(std::cout, "Cyclic");
+      }
+      else
+      {
+        for (const auto& session : sessions)
+        {
+          session->SendHistogram->Print(std::cout, session->SenderLabel);
+          session->ReceiveHistogram->Print(std::cout, session->ReceiverLabel);
+        }
+      }
+      std::cout << std::flush;
+    }
+
   }
   catch(const std::exception& error)
   {
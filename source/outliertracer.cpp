@@ -0,0 +1,191 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <chrono>
+#include <ctime>
+#include <fcntl.h>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+
+#include "outliertracer.h"
+
+namespace
+{
+  // Newer kernels mount the tracefs directly; older ones only expose it under
+  // debugfs.
+  std::string DetectTracingRoot()
+  {
+    const char* roots[] =
+    {
+      "/sys/kernel/tracing",
+      "/sys/kernel/debug/tracing"
+    };
+    for (const char* root : roots)
+    {
+      if (access((std::string(root) + "/trace_marker").c_str(), W_OK) == 0)
+      {
+        return root;
+      }
+    }
+    return "";
+  }
+
+  std::string ReadFirstLine(const std::string& path)
+  {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+  }
+
+  void WriteWallClock(std::ostream& stream)
+  {
+    const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm local = {};
+    localtime_r(&now, &local);
+    stream << std::put_time(&local, "%F %T");
+  }
+}
+
+namespace Evaluator
+{
+  OutlierTracer::OutlierTracer(const std::string& argLogPath, uint64_t argThresholdNanoseconds, bool argFreezeTracing)
+    : logPath(argLogPath)
+    , threshold(argThresholdNanoseconds)
+    , freezeTracing(argFreezeTracing)
+    , sendRing(RingCapacity)
+    , receiveRing(RingCapacity)
+  {
+    // Append rather than truncate so repeated soak runs accumulate into one
+    // forensics file; each run writes its own header line.
+    log.open(logPath, std::ios::app);
+    if (!log)
+    {
+      throw std::runtime_error("Failed to open outlier log: " + logPath);
+    }
+    log << "=== rmp-eval outlier log, threshold " << threshold << " ns, started ";
+    WriteWallClock(log);
+    log << " ===\n" << std::flush;
+
+    tracingRoot = DetectTracingRoot();
+    if (tracingRoot.empty())
+    {
+      std::cerr << "WARN: no writable trace_marker found; outliers are logged without ftrace cursors.\n";
+    }
+    else
+    {
+      markerDescriptor = open((tracingRoot + "/trace_marker").c_str(), O_WRONLY | O_CLOEXEC);
+    }
+
+    drainer = std::thread(&OutlierTracer::DrainThread, this);
+  }
+
+  void OutlierTracer::LogOutlier(const char* stream, const SampleRing::Sample& sample)
+  {
+    ++outliers;
+
+    // The marker lands in the ftrace ring with the kernel's own timestamp, so
+    // a concurrent trace-cmd capture can be cut at exactly this cycle.
+    if (markerDescriptor >= 0)
+    {
+      std::ostringstream marker;
+      marker << "rmp-eval outlier: stream=" << stream << " index=" << sample.Index
+             << " period=" << sample.Observation << " ns";
+      const std::string message = marker.str();
+      if (write(markerDescriptor, message.c_str(), message.size()) < 0)
+      {
+        perror("write trace_marker");
+      }
+    }
+
+    // Freeze the ftrace ring at the first outlier so the lead-up to the event
+    // survives until someone reads it.
+    if (freezeTracing && !frozen && !tracingRoot.empty())
+    {
+      std::ofstream tracingOn(tracingRoot + "/tracing_on");
+      tracingOn << "0";
+      frozen = true;
+      log << "(tracing_on set to 0 at first outlier)\n";
+    }
+
+    log << "[";
+    WriteWallClock(log);
+    log << "] " << stream << " index=" << sample.Index << " period=" << sample.Observation
+        << " ns (threshold " << threshold << " ns)";
+    if (!tracingRoot.empty())
+    {
+      log << " tracer=" << ReadFirstLine(tracingRoot + "/current_tracer")
+          << " tracing_on=" << ReadFirstLine(tracingRoot + "/tracing_on");
+    }
+    log << "\n";
+
+    if (snapshots < SnapshotLimit)
+    {
+      ++snapshots;
+      log << "--- /proc/interrupts ---\n";
+      std::ifstream interrupts("/proc/interrupts");
+      std::string line;
+      while (std::getline(interrupts, line))
+      {
+        log << line << "\n";
+      }
+      log << "--- end ---\n";
+    }
+    log << std::flush;
+  }
+
+  size_t OutlierTracer::DrainRing(SampleRing& ring, const char* stream)
+  {
+    SampleRing::Sample sample = {};
+    size_t total = 0;
+    while (ring.Pop(&sample, 1) > 0)
+    {
+      LogOutlier(stream, sample);
+      ++total;
+    }
+    return total;
+  }
+
+  void OutlierTracer::DrainThread()
+  {
+    static constexpr auto DrainInterval = std::chrono::milliseconds(10);
+    while (draining.load(std::memory_order_acquire))
+    {
+      DrainRing(sendRing, "sender");
+      DrainRing(receiveRing, "receiver");
+      std::this_thread::sleep_for(DrainInterval);
+    }
+    // Final drain after the RT threads have stopped.
+    DrainRing(sendRing, "sender");
+    DrainRing(receiveRing, "receiver");
+  }
+
+  OutlierTracer::~OutlierTracer()
+  {
+    draining.store(false, std::memory_order_release);
+    if (drainer.joinable())
+    {
+      drainer.join();
+    }
+
+    log << "=== run ended, " << outliers << " outliers ===\n";
+    if (markerDescriptor >= 0)
+    {
+      close(markerDescriptor);
+    }
+
+    const uint64_t dropped = sendRing.DroppedSamples() + receiveRing.DroppedSamples();
+    if (dropped > 0)
+    {
+      std::cerr << "WARN: outlier tracer dropped " << dropped << " events (mailbox full)\n";
+    }
+    if (outliers > 0)
+    {
+      std::cerr << "WARN: " << outliers << " cycles exceeded the trace threshold; forensics appended to "
+                << logPath << "\n";
+    }
+  }
+} // end namespace Evaluator
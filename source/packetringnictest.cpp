@@ -0,0 +1,244 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <arpa/inet.h>
+#include <cstdio>
+#include <cstring>
+#include <linux/if_packet.h>
+#include <linux/net_tstamp.h>
+#include <linux/sockios.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "nictest.h"
+
+static constexpr uint16_t EthernetFrameTypeBKHF = 0x88A4;
+
+namespace Evaluator
+{
+  namespace
+  {
+    // Ring geometry: one page-sized block per frame keeps the math trivial
+    // and 64 slots per direction is far more than the single frame we keep
+    // in flight. The mapping is locked by the MCL_FUTURE lock in main().
+    constexpr uint32_t RingFrameSize = 2048;
+    constexpr uint32_t RingBlockSize = 4096;
+    constexpr uint32_t RingBlockCount = 32;
+    constexpr uint32_t RingFrameCount = RingBlockCount * (RingBlockSize / RingFrameSize);
+
+    // The slot status word is shared with the kernel; go through atomic_ref.
+    uint32_t LoadStatus(volatile uint32_t* status)
+    {
+      return std::atomic_ref<uint32_t>(*const_cast<uint32_t*>(status)).load(std::memory_order_acquire);
+    }
+
+    void StoreStatus(volatile uint32_t* status, uint32_t value)
+    {
+      std::atomic_ref<uint32_t>(*const_cast<uint32_t*>(status)).store(value, std::memory_order_release);
+    }
+  } // end anonymous namespace
+
+  PacketRingNicTest::PacketRingNicTest(const TestParameters& argParams,
+    TimerReport&& hardwareReport, TimerReport&& softwareReport)
+    : frameCount(RingFrameCount)
+    , params(argParams)
+    , hardwareReport(std::move(hardwareReport))
+    , softwareReport(std::move(softwareReport))
+  {
+    frameLength = BuildProbeFrame(frameBuffer.data(), params.Datagrams);
+
+    socketDescriptor = socket(PF_PACKET, SOCK_RAW, htons(EthernetFrameTypeBKHF));
+    if (socketDescriptor == -1)
+    {
+      throw std::runtime_error(AppendErrorCode("Failed to create socket."));
+    }
+
+    int version = TPACKET_V2;
+    if (setsockopt(socketDescriptor, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to set TPACKET_V2 on socket.")); }
+
+    // Skip the qdisc on TX; the probe frame goes straight to the driver.
+    constexpr int qdiscBypass = 1;
+    if (setsockopt(socketDescriptor, SOL_PACKET, PACKET_QDISC_BYPASS, &qdiscBypass, sizeof(qdiscBypass)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to set PACKET_QDISC_BYPASS on socket.")); }
+
+    // Enable hardware timestamping on the NIC and ask for ring-slot
+    // timestamps: raw hardware when the NIC provides one, software otherwise.
+    struct ifreq ifrts = {};
+    std::snprintf(ifrts.ifr_name, sizeof(ifrts.ifr_name), "%s", params.NicName.c_str());
+    struct hwtstamp_config cfg = {};
+    cfg.tx_type = HWTSTAMP_TX_ON;
+    cfg.rx_filter = HWTSTAMP_FILTER_ALL;
+    ifrts.ifr_data = (char *)&cfg;
+    ioctl(socketDescriptor, SIOCSHWTSTAMP, &ifrts);
+
+    int timestampFlags = SOF_TIMESTAMPING_RAW_HARDWARE | SOF_TIMESTAMPING_SOFTWARE;
+    if (setsockopt(socketDescriptor, SOL_PACKET, PACKET_TIMESTAMP, &timestampFlags, sizeof(timestampFlags)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to set PACKET_TIMESTAMP on socket.")); }
+
+    // Size both rings before the single mmap that covers RX then TX.
+    struct tpacket_req request = {};
+    request.tp_block_size = RingBlockSize;
+    request.tp_block_nr = RingBlockCount;
+    request.tp_frame_size = RingFrameSize;
+    request.tp_frame_nr = RingFrameCount;
+    if (setsockopt(socketDescriptor, SOL_PACKET, PACKET_RX_RING, &request, sizeof(request)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to set up PACKET_RX_RING.")); }
+    if (setsockopt(socketDescriptor, SOL_PACKET, PACKET_TX_RING, &request, sizeof(request)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to set up PACKET_TX_RING.")); }
+
+    const size_t ringLength = static_cast<size_t>(RingBlockSize) * RingBlockCount;
+    ringMapLength = 2 * ringLength;
+    ringMap = mmap(nullptr, ringMapLength, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_LOCKED | MAP_POPULATE, socketDescriptor, 0);
+    if (ringMap == MAP_FAILED)
+    {
+      ringMap = nullptr;
+      throw std::runtime_error(AppendErrorCode("Failed to map PACKET_MMAP rings."));
+    }
+    rxRing = static_cast<unsigned char*>(ringMap);
+    txRing = rxRing + ringLength;
+
+    // Get the index of the interface
+    struct ifreq ifr;
+    std::snprintf(ifr.ifr_name, sizeof(ifr.ifr_name), "%s", params.NicName.c_str());
+    if (ioctl(socketDescriptor, SIOCGIFINDEX, &ifr) == -1)
+    {
+      std::string errorMessage = "Failed to get interface index for NIC: ";
+      errorMessage += params.NicName;
+      throw std::runtime_error(AppendErrorCode(errorMessage));
+    }
+    int interfaceIndex = ifr.ifr_ifindex;
+
+    // Set NIC flags to be promiscuous and broadcast, matching the raw backend
+    ifr.ifr_flags = 0;
+    if (ioctl(socketDescriptor, SIOCGIFFLAGS, &ifr) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to read interface flags.")); }
+    ifr.ifr_flags = ifr.ifr_flags | IFF_PROMISC | IFF_BROADCAST;
+    if (ioctl(socketDescriptor, SIOCSIFFLAGS, &ifr) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to set promiscuous and broadcast flags on NIC.")); }
+
+    // bind the socket
+    struct sockaddr_ll address = {};
+    address.sll_family = AF_PACKET;
+    address.sll_ifindex = interfaceIndex;
+    address.sll_protocol = htons(EthernetFrameTypeBKHF);
+    if (bind(socketDescriptor, (struct sockaddr *)&address, sizeof(address)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to bind socket on interface.")); }
+  }
+
+  void PacketRingNicTest::Send()
+  {
+    // Same lock-free rendezvous as the other backends.
+    {
+      const uint64_t currentSend = sendIteration.load(std::memory_order_relaxed);
+      if (!SpinWaitAbove(receiveIteration, currentSend, SocketTimeout))
+      {
+        char buffer[128] = {};
+        std::snprintf(buffer, sizeof(buffer), "Timed out waiting for receiver to be ready. sendIteration=%lu, receiveIteration=%lu",
+          currentSend, receiveIteration.load(std::memory_order_relaxed));
+        throw std::runtime_error(buffer);
+      }
+    }
+
+    auto* header = reinterpret_cast<struct tpacket2_hdr*>(txRing + static_cast<size_t>(txIndex) * RingFrameSize);
+    const uint32_t status = LoadStatus(&header->tp_status);
+    if (status != TP_STATUS_AVAILABLE && status != TP_STATUS_WRONG_FORMAT)
+    {
+      throw std::runtime_error("TX ring slot still owned by the kernel; previous send has not completed.");
+    }
+
+    // Frame data for a SOCK_RAW TX ring starts right after the slot header.
+    unsigned char* pData = reinterpret_cast<unsigned char*>(header) +
+      TPACKET_ALIGN(sizeof(struct tpacket2_hdr));
+    std::memcpy(pData, frameBuffer.data(), frameLength);
+
+    header->tp_len = frameLength;
+    StoreStatus(&header->tp_status, TP_STATUS_SEND_REQUEST);
+    txIndex = (txIndex + 1) % frameCount;
+
+    // Zero-copy kick: the kernel walks the ring, no payload crosses here.
+    if (send(socketDescriptor, nullptr, 0, MSG_DONTWAIT) == -1 && errno != EAGAIN)
+    { throw std::runtime_error(AppendErrorCode("Failed to kick PACKET_TX_RING.")); }
+
+    sendIteration.fetch_add(1, std::memory_order_release);
+  }
+
+  bool PacketRingNicTest::Receive()
+  {
+    receiveIteration.fetch_add(1, std::memory_order_release);
+
+    auto* header = reinterpret_cast<struct tpacket2_hdr*>(rxRing + static_cast<size_t>(rxIndex) * RingFrameSize);
+    if (!(LoadStatus(&header->tp_status) & TP_STATUS_USER))
+    {
+      constexpr int timeoutMs = 1000;
+      pollfd pollFd = { .fd = socketDescriptor, .events = POLLIN, .revents = 0 };
+      int ready = poll(&pollFd, 1, timeoutMs);
+      if (ready < 0)
+      { throw std::runtime_error(AppendErrorCode("There was an error during frame polling on socket.")); }
+      if (ready == 0 || !(LoadStatus(&header->tp_status) & TP_STATUS_USER))
+      {
+        return false;
+      }
+    }
+
+    // The slot header carries the timestamp directly; no cmsg walk needed.
+    const uint32_t status = LoadStatus(&header->tp_status);
+    const int64_t slotNanoseconds = static_cast<int64_t>(header->tp_sec) * static_cast<int64_t>(NanoPerSec)
+      + static_cast<int64_t>(header->tp_nsec);
+    const bool isHardware = (status & TP_STATUS_TS_RAW_HARDWARE) != 0;
+
+    const uint64_t iteration = receiveIteration.load(std::memory_order_relaxed);
+    if (isHardware)
+    {
+      if (prev.HaveHardware)
+      {
+        int64_t delta = slotNanoseconds - prev.HardwareNanoseconds;
+        if (delta >= 0)
+        {
+          hardwareReport.AddObservation(static_cast<uint64_t>(delta), static_cast<int>(iteration));
+          stats.HardwareDeltaNanoseconds.update(delta, iteration);
+        }
+      }
+      prev.HardwareNanoseconds = slotNanoseconds;
+      prev.HaveHardware = true;
+    }
+    else
+    {
+      if (prev.HaveSoftware)
+      {
+        int64_t delta = slotNanoseconds - prev.SoftwareNanoseconds;
+        if (delta >= 0)
+        {
+          softwareReport.AddObservation(static_cast<uint64_t>(delta), static_cast<int>(iteration));
+          stats.SoftwareDeltaNanoseconds.update(delta, iteration);
+        }
+      }
+      prev.SoftwareNanoseconds = slotNanoseconds;
+      prev.HaveSoftware = true;
+    }
+
+    // Hand the slot back to the kernel and advance.
+    StoreStatus(&header->tp_status, TP_STATUS_KERNEL);
+    rxIndex = (rxIndex + 1) % frameCount;
+    return true;
+  }
+
+  PacketRingNicTest::~PacketRingNicTest()
+  {
+    if (ringMap != nullptr)
+    {
+      munmap(ringMap, ringMapLength);
+      ringMap = nullptr;
+    }
+    if (socketDescriptor >= 0)
+    {
+      close(socketDescriptor);
+      socketDescriptor = -1;
+    }
+  }
+} // end namespace Evaluator
@@ -0,0 +1,214 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <cstring>
+#include <fstream>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "perfcounters.h"
+
+namespace
+{
+  int PerfEventOpen(perf_event_attr* attributes, pid_t pid, int cpu, int groupFd, unsigned long flags)
+  {
+    return static_cast<int>(syscall(__NR_perf_event_open, attributes, pid, cpu, groupFd, flags));
+  }
+
+  constexpr uint64_t CacheConfig(uint64_t cache, uint64_t operation, uint64_t result)
+  {
+    return cache | (operation << 8) | (result << 16);
+  }
+
+  // The SMI counter lives on the dynamic "msr" PMU; its type number and event
+  // encoding are only discoverable through sysfs.
+  bool ReadSmiEvent(uint32_t& type, uint64_t& config)
+  {
+    std::ifstream typeFile("/sys/bus/event_source/devices/msr/type");
+    std::ifstream eventFile("/sys/bus/event_source/devices/msr/events/smi");
+    if (!typeFile || !eventFile)
+    {
+      return false;
+    }
+    typeFile >> type;
+    std::string event; // formatted as "event=0x04"
+    eventFile >> event;
+    const size_t equals = event.find('=');
+    if (!typeFile || equals == std::string::npos)
+    {
+      return false;
+    }
+    config = std::strtoull(event.c_str() + equals + 1, nullptr, 0);
+    return true;
+  }
+}
+
+namespace Evaluator
+{
+  PerfCounters::PerfCounters(uint64_t argTarget, uint64_t argBucketWidth)
+    : target(argTarget)
+    , bucketWidth(argBucketWidth)
+  {}
+
+  PerfCounters::~PerfCounters()
+  {
+    for (const Counter& counter : counters)
+    {
+      if (counter.Descriptor >= 0)
+      {
+        close(counter.Descriptor);
+      }
+    }
+  }
+
+  int PerfCounters::OpenCounter(uint32_t type, uint64_t config, const std::string& name)
+  {
+    perf_event_attr attributes = {};
+    attributes.size = sizeof(attributes);
+    attributes.type = type;
+    attributes.config = config;
+    // Kernel-side events (the context switch itself, SMI accounting) are the
+    // point of this instrumentation, so nothing is excluded.
+    attributes.read_format = PERF_FORMAT_GROUP;
+
+    // The msr PMU cannot join a hardware/software group, so its counters are
+    // opened standalone and read separately.
+    const bool standalone = type != PERF_TYPE_SOFTWARE && type != PERF_TYPE_HARDWARE && type != PERF_TYPE_HW_CACHE;
+    if (standalone)
+    {
+      attributes.read_format = 0;
+    }
+    const int groupFd = standalone ? -1 : groupLeader;
+
+    // pid 0, cpu -1: the counter follows this thread, which ConfigureThisThread
+    // has already pinned to its RT core.
+    const int descriptor = PerfEventOpen(&attributes, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC);
+    if (descriptor < 0)
+    {
+      std::cerr << "Perf counter " << name << " unavailable: " << strerror(errno) << std::endl;
+      return -1;
+    }
+
+    Counter counter;
+    counter.Name = name;
+    counter.Descriptor = descriptor;
+    if (standalone)
+    {
+      standaloneCounters.push_back(counters.size());
+    }
+    else
+    {
+      groupCounters.push_back(counters.size());
+      if (groupLeader < 0)
+      {
+        groupLeader = descriptor;
+      }
+    }
+    counters.push_back(std::move(counter));
+    return descriptor;
+  }
+
+  void PerfCounters::Open()
+  {
+    OpenCounter(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, "context-switches");
+    OpenCounter(PERF_TYPE_HW_CACHE,
+      CacheConfig(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS),
+      "llc-misses");
+    OpenCounter(PERF_TYPE_HW_CACHE,
+      CacheConfig(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS),
+      "dtlb-misses");
+
+    uint32_t msrType = 0;
+    uint64_t smiConfig = 0;
+    if (ReadSmiEvent(msrType, smiConfig))
+    {
+      OpenCounter(msrType, smiConfig, "smi");
+    }
+    else
+    {
+      std::cerr << "Perf counter smi unavailable: no msr PMU in sysfs." << std::endl;
+    }
+
+    readBuffer.resize(1 + groupCounters.size());
+  }
+
+  void PerfCounters::RecordCycle(uint64_t observation)
+  {
+    if (counters.empty())
+    {
+      return;
+    }
+
+    // One read() returns the whole group: { nr, value[nr] } in open order.
+    if (groupLeader >= 0)
+    {
+      const ssize_t expected = static_cast<ssize_t>(readBuffer.size() * sizeof(uint64_t));
+      if (read(groupLeader, readBuffer.data(), expected) != expected)
+      {
+        return;
+      }
+    }
+
+    const uint64_t difference = observation >= target ? observation - target : 0;
+    const size_t bucket = GetBucketIndex(difference, bucketWidth, BucketCount);
+
+    auto attribute = [&](Counter& counter, uint64_t value)
+    {
+      const uint64_t delta = value - counter.Previous;
+      counter.Previous = value;
+      if (primed && delta > 0)
+      {
+        counter.NonzeroCycles[bucket]++;
+        counter.DeltaSum[bucket] += delta;
+      }
+    };
+
+    for (size_t index = 0; index < groupCounters.size(); ++index)
+    {
+      attribute(counters[groupCounters[index]], readBuffer[1 + index]);
+    }
+    for (const size_t index : standaloneCounters)
+    {
+      uint64_t value = 0;
+      if (read(counters[index].Descriptor, &value, sizeof(value)) == sizeof(value))
+      {
+        attribute(counters[index], value);
+      }
+    }
+
+    if (primed)
+    {
+      bucketCycles[bucket]++;
+    }
+    primed = true;
+  }
+
+  void PerfCounters::Print(std::ostream& stream, std::string_view label) const
+  {
+    if (counters.empty())
+    {
+      return;
+    }
+
+    stream << label << " perf counters by latency bucket (cycles with nonzero delta / cycles in bucket):\n";
+    for (const Counter& counter : counters)
+    {
+      stream << "  " << counter.Name << ":";
+      for (size_t bucket = 0; bucket < BucketCount; ++bucket)
+      {
+        if (bucketCycles[bucket] == 0)
+        {
+          continue;
+        }
+        stream << "  " << BucketColorScheme::GetCategory(bucket) << " "
+               << counter.NonzeroCycles[bucket] << "/" << bucketCycles[bucket];
+        if (counter.DeltaSum[bucket] > 0)
+        {
+          stream << " (sum " << counter.DeltaSum[bucket] << ")";
+        }
+      }
+      stream << "\n";
+    }
+  }
+} // end namespace Evaluator
@@ -108,9 +108,137 @@ namespace Evaluator
     }
   
     AdjustMarkerPositions(observation);
-  
+
     numObservations++;
-  
+
     AdjustMarkerHeights();
   }
+
+  MultiQuantileEstimator::MultiQuantileEstimator(std::vector<double> _quantiles)
+    : numObservations(0)
+    , markerCount(static_cast<int>(2 * _quantiles.size() + 3))
+    , quantiles(std::move(_quantiles))
+  {
+    markerHeights.assign(markerCount, 0);
+    markerPositions.resize(markerCount);
+    desiredMarkerPositions.resize(markerCount);
+    desiredMarkerPositionIncrements.resize(markerCount);
+    for (int index = 0; index < markerCount; index++)
+    {
+      markerPositions[index] = index;
+      desiredMarkerPositions[index] = index;
+    }
+
+    // The extended marker layout: the minimum, then for each quantile the
+    // midpoint to its lower neighbor followed by the quantile itself, then
+    // the midpoint to 1, then the maximum. Quantile i lands at marker 2i+2.
+    desiredMarkerPositionIncrements[0] = 0;
+    double previous = 0;
+    for (size_t index = 0; index < quantiles.size(); index++)
+    {
+      desiredMarkerPositionIncrements[2 * index + 1] = (previous + quantiles[index]) / 2;
+      desiredMarkerPositionIncrements[2 * index + 2] = quantiles[index];
+      previous = quantiles[index];
+    }
+    desiredMarkerPositionIncrements[markerCount - 2] = (previous + 1) / 2;
+    desiredMarkerPositionIncrements[markerCount - 1] = 1;
+  }
+
+  double MultiQuantileEstimator::GetQuantile(size_t index) const
+  {
+    return markerHeights[2 * index + 2];
+  }
+
+  void MultiQuantileEstimator::AddInitialObservation(const double observation)
+  {
+    markerHeights[numObservations] = observation;
+    if (++numObservations == markerCount)
+    {
+      std::sort(markerHeights.begin(), markerHeights.end());
+    }
+  }
+
+  double MultiQuantileEstimator::Parabolic(const int index, const int increment)
+  {
+    double height = markerHeights[index];
+    const int next = index+1, prev = index-1;
+    const double prev_position = markerPositions[prev];
+    const double next_position = markerPositions[next];
+    const double factor = increment / (next_position - prev_position);
+
+    const double cur_position = markerPositions[index];
+    const double addend1 = (cur_position - prev_position + increment) * (markerHeights[next] - height) / (next_position - cur_position);
+    const double addend2 = (next_position - cur_position - increment) * (height - markerHeights[prev]) / (cur_position - prev_position);
+    const double parabolic = height + factor * (addend1 + addend2);
+    return parabolic;
+  }
+
+  double MultiQuantileEstimator::Linear(const int index, const int increment)
+  {
+    double height = markerHeights[index];
+    return height + increment * (markerHeights[index + increment] - height) / (markerPositions[index + increment] - markerPositions[index]);
+  }
+
+  void MultiQuantileEstimator::AddObservation(const double observation)
+  {
+    if (numObservations < markerCount)
+    {
+      AddInitialObservation(observation);
+      return;
+    }
+
+    // Find which marker interval the observation falls in, clamping the
+    // extremes exactly as the single-quantile version does.
+    int increment_bound = markerCount - 2;
+    if (observation < markerHeights[0])
+    {
+      markerHeights[0] = observation;
+      increment_bound = 0;
+    }
+    else if (observation > markerHeights[markerCount - 1])
+    {
+      markerHeights[markerCount - 1] = observation;
+    }
+    else
+    {
+      for (int index = 1; index < markerCount; index++)
+      {
+        if (observation < markerHeights[index])
+        {
+          increment_bound = index - 1;
+          break;
+        }
+      }
+    }
+    for (int index = increment_bound + 1; index < markerCount; index++) { ++markerPositions[index]; }
+    for (int index = 0; index < markerCount; index++)
+    { desiredMarkerPositions[index] += desiredMarkerPositionIncrements[index]; }
+
+    numObservations++;
+
+    // Adjust every interior marker, same rules as the single-quantile version
+    // applies to its three.
+    for (int index = 1; index <= markerCount - 2; index++)
+    {
+      double& marker_position = markerPositions[index];
+      double difference = desiredMarkerPositions[index] - marker_position;
+
+      if ((difference >= 1 && markerPositions[index + 1] - marker_position > 1) ||
+          (difference <= -1 && markerPositions[index - 1] - marker_position < -1))
+      {
+        int increment = difference > 0 ? 1 : -1;
+        double candidate = Parabolic(index, increment);
+
+        if (markerHeights[index - 1] < candidate && candidate < markerHeights[index + 1])
+        {
+          markerHeights[index] = candidate;
+        }
+        else
+        {
+          markerHeights[index] = Linear(index, increment);
+        }
+        marker_position += increment;
+      }
+    }
+  }
 } // end namespace Evaluator
@@ -5,8 +5,10 @@
 #include <cmath>
 #include <bit>
 #include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -104,16 +106,10 @@ namespace Evaluator
     ValueFormatter(stream, ValueGetter(data), Width);
   }
 
-  static size_t GetBucketIndex(uint64_t element, uint64_t bucketWidth, size_t bucketCount)
-  {
-    size_t deviations = element / bucketWidth;
-    size_t bucketIndex = std::bit_width(deviations);
-    return std::min(bucketIndex, bucketCount - 1);
-  }
-
   static constexpr double NanoToMicro = 0.001;
 
-  TableMaker TableMaker::CreateTableMaker(uint64_t bucketWidth, bool isVerbose)
+  TableMaker TableMaker::CreateTableMaker(uint64_t bucketWidth, bool isVerbose, bool withPercentiles,
+    bool withDeadlineMisses)
   {
     TableMaker tableMaker;
     tableMaker.bucketWidth = bucketWidth;
@@ -146,6 +142,22 @@ namespace Evaluator
         }});
     } // end if (isVerbose)
 
+    if (withPercentiles)
+    {
+      tableMaker.AddColumn(TableColumn{ "p99", TableColumn::DefaultColumnWidth,
+        [](ReportData& data) { return static_cast<uint64_t>(data.p99 * NanoToMicro); } });
+      tableMaker.AddColumn(TableColumn{ "p99.9", TableColumn::DefaultColumnWidth,
+        [](ReportData& data) { return static_cast<uint64_t>(data.p999 * NanoToMicro); } });
+      tableMaker.AddColumn(TableColumn{ "p99.99", TableColumn::DefaultColumnWidth,
+        [](ReportData& data) { return static_cast<uint64_t>(data.p9999 * NanoToMicro); } });
+    }
+
+    if (withDeadlineMisses)
+    {
+      tableMaker.AddColumn(TableColumn{ "Misses", TableColumn::DefaultColumnWidth,
+        [](ReportData& data) { return data.deadlineMisses; } });
+    }
+
     // Add buckets
     static constexpr auto lastBucket = BucketCount - 1UL;
     static constexpr size_t bufferSize = 32;
@@ -231,7 +243,7 @@ namespace Evaluator
     columns.push_back(std::move(column));
   }
 
-  void TableMaker::OptimizeRowLabelWidth(const std::vector<std::pair<std::string_view, ReportData*>>& reports)
+  void TableMaker::OptimizeRowLabelWidth(const std::vector<std::pair<std::string_view, ReportSlot*>>& reports)
   {
     int maxWidth = DefaultRowLabelWidth;
     for (const auto& [label, _] : reports)
@@ -292,6 +304,21 @@ namespace Evaluator
     OptimizeColumnWidthsForCategories();
   }
 
+  bool TableMaker::ColumnWidthsFit(const std::vector<std::pair<std::string_view, ReportData*>>& reports) const
+  {
+    for (const auto& col : columns)
+    {
+      for (const auto& [_, dataPtr] : reports)
+      {
+        if (dataPtr != nullptr && GetDigitCount(col.ValueGetter(*dataPtr)) > col.Width)
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
   void TableMaker::OptimizeColumnWidthsForCategories()
   {
     static constexpr int SeparatorWidth = 3; // " | "
@@ -445,16 +472,195 @@ namespace Evaluator
            << BucketColorScheme::GetResetColor() << ".\n";
   }
 
-  TimerReport::TimerReport(uint64_t argTarget, uint64_t argBucketWidth, ReportData* argUpload)
-    : uploadLocation(argUpload)
+  void EnableTscClock(std::ostream& stream)
+  {
+#if !defined(__x86_64__)
+    throw std::runtime_error("--clock tsc is only supported on x86_64.");
+#else
+    // The kernel demotes an unstable TSC, so trusting it only when the active
+    // clocksource is tsc covers the invariant-TSC requirement.
+    std::ifstream clocksourceFile("/sys/devices/system/clocksource/clocksource0/current_clocksource");
+    std::string clocksource;
+    clocksourceFile >> clocksource;
+    if (clocksource != "tsc")
+    {
+      throw std::runtime_error("--clock tsc requires the kernel clocksource to be tsc, found '" + clocksource + "'.");
+    }
+
+    // Calibrate tick rate against CLOCK_MONOTONIC over a short interval. The
+    // interval is long enough that the ~tens of ns of sampling skew at each
+    // end contribute well under a ppm of rate error.
+    timespec startTime = {};
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+    const uint64_t startTicks = ReadTscOrdered();
+
+    static constexpr auto CalibrationInterval = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(CalibrationInterval);
+
+    timespec endTime = {};
+    clock_gettime(CLOCK_MONOTONIC, &endTime);
+    const uint64_t endTicks = ReadTscOrdered();
+
+    const uint64_t elapsedNanoseconds = ToEpoch(endTime) - ToEpoch(startTime);
+    const uint64_t elapsedTicks = endTicks - startTicks;
+    if (elapsedTicks == 0)
+    {
+      throw std::runtime_error("TSC calibration failed: counter did not advance.");
+    }
+
+    TscClockState::NanosPerTick = static_cast<double>(elapsedNanoseconds) / static_cast<double>(elapsedTicks);
+    TscClockState::BaseTicks = endTicks;
+    TscClockState::BaseNanoseconds = ToEpoch(endTime);
+    TscClockState::Enabled.store(true, std::memory_order_release);
+
+    stream << "Clock: tsc @ " << std::setprecision(6)
+           << (1.0 / TscClockState::NanosPerTick) << " GHz, "
+           << std::setprecision(1) << std::fixed << MeasureClockReadOverhead()
+           << " ns/read" << "\n";
+    stream.unsetf(std::ios_base::floatfield);
+#endif // defined(__x86_64__)
+  }
+
+  double MeasureClockReadOverhead()
+  {
+    static constexpr int Reads = 100000;
+    const uint64_t startTime = GetCurrentTime();
+    uint64_t sink = 0;
+    for (int read = 0; read < Reads; ++read)
+    {
+      sink += GetCurrentTime();
+    }
+    const uint64_t endTime = GetCurrentTime();
+    // Keep the loop from being optimized away.
+    asm volatile("" : : "r"(sink));
+    return static_cast<double>(endTime - startTime) / Reads;
+  }
+
+  uint64_t Histogram::Percentile(double percentile) const
+  {
+    if (total == 0)
+    {
+      return 0;
+    }
+    const uint64_t rank = static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(total)));
+    uint64_t cumulative = 0;
+    for (size_t slot = 0; slot < SlotCount; ++slot)
+    {
+      cumulative += counts[slot];
+      if (cumulative >= rank)
+      {
+        return SlotLowerBound(slot);
+      }
+    }
+    return SlotLowerBound(SlotCount - 1);
+  }
+
+  void Histogram::Print(std::ostream& stream, std::string_view label) const
+  {
+    stream << "# Histogram: " << label << " (" << total << " observations)\n";
+    stream << "# us: count\n";
+    for (size_t slot = 0; slot < SlotCount; ++slot)
+    {
+      if (counts[slot] == 0)
+      {
+        continue;
+      }
+      stream << std::setprecision(1) << std::fixed
+             << (static_cast<double>(SlotLowerBound(slot)) * NanoToMicro)
+             << ": " << counts[slot] << "\n";
+      stream.unsetf(std::ios_base::floatfield);
+    }
+    static constexpr double TailPercentiles[] = { 0.99, 0.999, 0.9999 };
+    static constexpr const char* TailLabels[] = { "p99", "p99.9", "p99.99" };
+    for (size_t index = 0; index < std::size(TailPercentiles); ++index)
+    {
+      stream << "# " << TailLabels[index] << ": "
+             << std::setprecision(1) << std::fixed
+             << (static_cast<double>(Percentile(TailPercentiles[index])) * NanoToMicro) << " us\n";
+      stream.unsetf(std::ios_base::floatfield);
+    }
+  }
+
+  TimerReport::TimerReport(uint64_t argTarget, uint64_t argBucketWidth, ReportSlot* argUpload,
+    Histogram* argHistogram, bool argTrackPercentiles, WindowSlots* argWindows)
+    : windowSlots(argWindows)
+    , uploadLocation(argUpload)
+    , histogram(argHistogram)
     , target(argTarget)
     , bucketWidth(argBucketWidth)
-  {}
+  {
+    if (argTrackPercentiles)
+    {
+      tailQuantiles = std::make_unique<MultiQuantileEstimator>(std::vector<double>{0.99, 0.999, 0.9999});
+    }
+    if (argWindows != nullptr && target > 0)
+    {
+      ring = std::make_unique<WindowRing>();
+      ring->perWindow = std::max<uint64_t>(1, WindowRing::SubWindowSeconds * NanoPerSec / target);
+      ring->remaining = ring->perWindow;
+    }
+  }
+
+  ReportData TimerReport::MergeWindows(size_t subWindowCount) const
+  {
+    // Merge the most recent completed sub-windows, newest first, walking
+    // backwards from the one currently being filled.
+    ReportData merged;
+    merged.target = target;
+    merged.bucketWidth = bucketWidth;
+    const size_t available = std::min<size_t>(ring->completed, subWindowCount);
+    size_t index = ring->current;
+    for (size_t window = 0; window < available; ++window)
+    {
+      index = (index + WindowRing::SubWindowCount - 1) % WindowRing::SubWindowCount;
+      const ReportData& sub = ring->windows[index];
+      merged.observations += sub.observations;
+      merged.sum += sub.sum;
+      if (sub.min < merged.min)
+      {
+        merged.min = sub.min;
+        merged.minIndex = sub.minIndex;
+      }
+      if (sub.max > merged.max)
+      {
+        merged.max = sub.max;
+        merged.maxIndex = sub.maxIndex;
+      }
+      for (size_t bucket = 0; bucket < BucketCount; ++bucket)
+      {
+        merged.buckets[bucket] += sub.buckets[bucket];
+      }
+    }
+    return merged;
+  }
+
+  void TimerReport::AdvanceWindow()
+  {
+    ReportData& completed = ring->windows[ring->current];
+    completed.target = target;
+    completed.bucketWidth = bucketWidth;
+    ring->completed++;
+
+    if (ring->completed == 1)
+    {
+      windowSlots->FirstWindow.Publish(completed);
+    }
+    if (completed.max > ring->worstMax)
+    {
+      ring->worstMax = completed.max;
+      windowSlots->WorstWindow.Publish(completed);
+    }
+
+    // Advance before merging so the merge walks back from the fresh slot.
+    ring->current = (ring->current + 1) % WindowRing::SubWindowCount;
+    ring->windows[ring->current] = ReportData{};
+    ring->remaining = ring->perWindow;
+
+    static constexpr size_t OneMinuteWindows = 60 / WindowRing::SubWindowSeconds;
+    windowSlots->OneMinute.Publish(MergeWindows(OneMinuteWindows));
+    windowSlots->TenMinutes.Publish(MergeWindows(WindowRing::SubWindowCount));
+  }
 
-  // we don't currently protect it with mutexes because this is only used for read-only printing at the moment
-  // and we want to keep the real time threads lockless for now.
-  // We need to look into using priority-inheriting and robust mutexes if we want to use mutexes.
-  // Alternatively, if we get mangled data, we may try atomic operations instead.
   ReportData TimerReport::Snapshot() const
   {
     ReportData data;
@@ -465,17 +671,52 @@ namespace Evaluator
     data.maxIndex = maxIndex;
     data.observations = observations;
     data.median = median.GetQuantile();
+    if (tailQuantiles != nullptr)
+    {
+      data.p99 = tailQuantiles->GetQuantile(0);
+      data.p999 = tailQuantiles->GetQuantile(1);
+      data.p9999 = tailQuantiles->GetQuantile(2);
+    }
+    if (deadlineMissCounter != nullptr)
+    {
+      data.deadlineMisses = deadlineMissCounter->load(std::memory_order_relaxed);
+    }
     data.target = target;
     data.bucketWidth = bucketWidth;
     std::memcpy(data.buckets, buckets, sizeof(buckets));
     return data;
   }
 
+  void TimerReport::RestoreBaseline(const ReportData& baseline)
+  {
+    min = baseline.min;
+    max = baseline.max;
+    sum = baseline.sum;
+    minIndex = baseline.minIndex;
+    maxIndex = baseline.maxIndex;
+    observations = baseline.observations;
+    std::memcpy(buckets, baseline.buckets, sizeof(buckets));
+    if (uploadLocation != nullptr)
+    {
+      // Show the resumed totals immediately instead of an empty row until
+      // the first new cycle publishes.
+      uploadLocation->Publish(Snapshot());
+    }
+  }
+
   void TimerReport::AddObservation(uint64_t observation, int index)
   {
     observations++;
     sum += observation;
     median.AddObservation(observation);
+    if (tailQuantiles != nullptr)
+    {
+      tailQuantiles->AddObservation(observation);
+    }
+    if (histogram != nullptr)
+    {
+      histogram->Record(observation);
+    }
 
     if (observation < min)
     {
@@ -489,12 +730,36 @@ namespace Evaluator
     }
     
     int64_t difference = std::cmp_greater_equal(observation, target) ? (observation - target) : 0;
-    ++buckets[GetBucketIndex(difference, bucketWidth, BucketCount)];
+    const size_t bucketIndex = GetBucketIndex(difference, bucketWidth, BucketCount);
+    ++buckets[bucketIndex];
+
+    if (ring != nullptr)
+    {
+      ReportData& window = ring->windows[ring->current];
+      window.observations++;
+      window.sum += observation;
+      if (observation < window.min)
+      {
+        window.min = observation;
+        window.minIndex = index;
+      }
+      if (observation > window.max)
+      {
+        window.max = observation;
+        window.maxIndex = index;
+      }
+      ++window.buckets[bucketIndex];
+      if (--ring->remaining == 0)
+      {
+        AdvanceWindow();
+      }
+    }
 
     if (uploadLocation != nullptr)
     {
-      auto snapshot = Snapshot();
-      *uploadLocation = snapshot;
+      // Seqlock publication: the slot copy is wait-free for this RT writer and
+      // the reporter thread retries until it sees a consistent snapshot.
+      uploadLocation->Publish(Snapshot());
     }
   }
 
@@ -503,6 +768,21 @@ namespace Evaluator
   //   PrintReportCountLines(Snapshot(), isVerbose, stream);
   // }
 
+  void PrintSoakRegression(std::string_view label, WindowSlots& slots, std::ostream& stream)
+  {
+    const ReportData first = slots.FirstWindow.Read();
+    const ReportData worst = slots.WorstWindow.Read();
+    if (first.observations == 0 || worst.observations == 0)
+    {
+      return;
+    }
+    const double ratio = first.max > 0 ? static_cast<double>(worst.max) / static_cast<double>(first.max) : 0.0;
+    stream << label << " soak check: first window max " << static_cast<uint64_t>(first.max * NanoToMicro)
+           << "µs, worst window max " << static_cast<uint64_t>(worst.max * NanoToMicro) << "µs ("
+           << std::fixed << std::setprecision(2) << ratio << "x) at index " << worst.maxIndex << ".\n";
+    stream.unsetf(std::ios_base::floatfield);
+  }
+
   DurationReporter::DurationReporter(const std::string& msg)
     : msg_(msg)
     , start_(std::chrono::steady_clock::now())
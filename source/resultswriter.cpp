@@ -0,0 +1,222 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#include "resultswriter.h"
+
+namespace
+{
+  const char* StatusName(Evaluator::Status status)
+  {
+    switch (status)
+    {
+      case Evaluator::Status::Pass: return "pass";
+      case Evaluator::Status::Fail: return "fail";
+      default: return "unknown";
+    }
+  }
+
+  // Minimal JSON string escaping; labels and check reasons only contain
+  // interface names and short sysfs values, but quoting them is cheap.
+  std::string EscapeJson(const std::string& text)
+  {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char character : text)
+    {
+      switch (character)
+      {
+        case '"': escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n"; break;
+        case '\t': escaped += "\\t"; break;
+        default: escaped += character; break;
+      }
+    }
+    return escaped;
+  }
+
+  uint64_t MeanOf(const Evaluator::ReportData& data)
+  {
+    return data.observations == 0 ? 0 : data.sum / data.observations;
+  }
+}
+
+namespace Evaluator
+{
+  ResultsWriter::ResultsWriter(const std::string& argPath, std::vector<Row> argRows,
+    std::vector<CheckResult> argChecks, uint64_t argPeriodNanoseconds,
+    std::chrono::seconds argCheckpointInterval, std::string argLoadDescription)
+    : path(argPath)
+    , rows(std::move(argRows))
+    , checks(std::move(argChecks))
+    , periodNanoseconds(argPeriodNanoseconds)
+    , checkpointInterval(argCheckpointInterval)
+    , loadDescription(std::move(argLoadDescription))
+  {
+    const size_t dotPosition = path.rfind('.');
+    const std::string extension = dotPosition == std::string::npos ? "" : path.substr(dotPosition);
+    if (extension == ".csv")
+    {
+      csv = true;
+    }
+    else if (extension != ".json")
+    {
+      throw std::runtime_error("Unsupported --output extension '" + extension + "'; use .json or .csv.");
+    }
+
+    if (checkpointInterval.count() > 0)
+    {
+      checkpointer = std::thread(&ResultsWriter::CheckpointThread, this);
+    }
+  }
+
+  ResultsWriter::~ResultsWriter()
+  {
+    running.store(false, std::memory_order_release);
+    if (checkpointer.joinable())
+    {
+      checkpointer.join();
+    }
+    WriteNow();
+  }
+
+  void ResultsWriter::CheckpointThread()
+  {
+    // Poll the stop flag at a short period so shutdown never waits out a long
+    // checkpoint interval.
+    static constexpr auto PollInterval = std::chrono::milliseconds(100);
+    auto nextCheckpoint = std::chrono::steady_clock::now() + checkpointInterval;
+    while (running.load(std::memory_order_acquire))
+    {
+      std::this_thread::sleep_for(PollInterval);
+      if (std::chrono::steady_clock::now() >= nextCheckpoint)
+      {
+        WriteNow();
+        nextCheckpoint += checkpointInterval;
+      }
+    }
+  }
+
+  void ResultsWriter::WriteNow()
+  {
+    std::vector<ReportData> snapshots;
+    snapshots.reserve(rows.size());
+    for (const auto& [label, slot] : rows)
+    {
+      snapshots.push_back(slot->Read());
+    }
+
+    // Write to a sibling temp file and rename over the target, so a reader
+    // polling the file (or a crash mid-write) never sees a partial document.
+    const std::string tempPath = path + ".tmp";
+    {
+      std::ofstream stream(tempPath, std::ios::trunc);
+      if (!stream)
+      {
+        std::cerr << "Failed to open results file " << tempPath << " for writing." << std::endl;
+        return;
+      }
+      if (csv)
+      {
+        WriteCsv(stream, snapshots);
+      }
+      else
+      {
+        WriteJson(stream, snapshots);
+      }
+    }
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+      std::cerr << "Failed to rename " << tempPath << " to " << path << "." << std::endl;
+    }
+  }
+
+  void ResultsWriter::WriteJson(std::ostream& stream, const std::vector<ReportData>& snapshots) const
+  {
+    stream << "{\n";
+    stream << "  \"period_ns\": " << periodNanoseconds << ",\n";
+    if (!loadDescription.empty())
+    {
+      stream << "  \"load\": \"" << EscapeJson(loadDescription) << "\",\n";
+    }
+
+    stream << "  \"checks\": [\n";
+    for (size_t index = 0; index < checks.size(); ++index)
+    {
+      stream << "    {\"name\": \"" << EscapeJson(checks[index].name)
+             << "\", \"status\": \"" << StatusName(checks[index].status)
+             << "\", \"reason\": \"" << EscapeJson(checks[index].reason) << "\"}"
+             << (index + 1 < checks.size() ? "," : "") << "\n";
+    }
+    stream << "  ],\n";
+
+    stream << "  \"rows\": [\n";
+    for (size_t index = 0; index < snapshots.size(); ++index)
+    {
+      const ReportData& data = snapshots[index];
+      stream << "    {\"label\": \"" << EscapeJson(rows[index].first) << "\", "
+             << "\"observations\": " << data.observations << ", "
+             << "\"min_ns\": " << (data.observations == 0 ? 0 : data.min) << ", "
+             << "\"max_ns\": " << data.max << ", "
+             << "\"mean_ns\": " << MeanOf(data) << ", "
+             << "\"median_ns\": " << static_cast<uint64_t>(data.median) << ", "
+             << "\"min_index\": " << data.minIndex << ", "
+             << "\"max_index\": " << data.maxIndex << ", "
+             << "\"target_ns\": " << data.target << ", "
+             << "\"bucket_width_ns\": " << data.bucketWidth << ", "
+             << "\"buckets\": [";
+      for (size_t bucket = 0; bucket < BucketCount; ++bucket)
+      {
+        stream << data.buckets[bucket] << (bucket + 1 < BucketCount ? ", " : "");
+      }
+      stream << "]}" << (index + 1 < snapshots.size() ? "," : "") << "\n";
+    }
+    stream << "  ]\n";
+    stream << "}\n";
+  }
+
+  void ResultsWriter::WriteCsv(std::ostream& stream, const std::vector<ReportData>& snapshots) const
+  {
+    // Check results and the load description go in comment lines so the data
+    // section stays a plain rectangular table for spreadsheet import.
+    if (!loadDescription.empty())
+    {
+      stream << "# load," << loadDescription << "\n";
+    }
+    for (const CheckResult& check : checks)
+    {
+      stream << "# check," << check.name << "," << StatusName(check.status) << "," << check.reason << "\n";
+    }
+
+    stream << "label,observations,min_ns,max_ns,mean_ns,median_ns,min_index,max_index,target_ns,bucket_width_ns";
+    for (size_t bucket = 0; bucket < BucketCount; ++bucket)
+    {
+      stream << ",bucket" << bucket;
+    }
+    stream << "\n";
+
+    for (size_t index = 0; index < snapshots.size(); ++index)
+    {
+      const ReportData& data = snapshots[index];
+      stream << rows[index].first << ","
+             << data.observations << ","
+             << (data.observations == 0 ? 0 : data.min) << ","
+             << data.max << ","
+             << MeanOf(data) << ","
+             << static_cast<uint64_t>(data.median) << ","
+             << data.minIndex << ","
+             << data.maxIndex << ","
+             << data.target << ","
+             << data.bucketWidth;
+      for (size_t bucket = 0; bucket < BucketCount; ++bucket)
+      {
+        stream << "," << data.buckets[bucket];
+      }
+      stream << "\n";
+    }
+  }
+} // end namespace Evaluator
@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "nictest.h" // AppendErrorCode
+#include "statssegment.h"
+
+namespace Evaluator
+{
+  StatsSegment::StatsSegment(const std::string& argPath,
+    const std::vector<std::pair<std::string_view, ReportSlot*>>& argRows,
+    uint64_t argPeriodNanoseconds)
+    : path(argPath)
+  {
+    descriptor = open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC | O_CLOEXEC, 0644);
+    if (descriptor < 0)
+    {
+      throw std::runtime_error(AppendErrorCode("Failed to create stats segment: " + path));
+    }
+
+    mapLength = sizeof(Header) + argRows.size() * sizeof(Row);
+    if (ftruncate(descriptor, static_cast<off_t>(mapLength)) != 0)
+    {
+      close(descriptor);
+      throw std::runtime_error(AppendErrorCode("Failed to size stats segment: " + path));
+    }
+    map = mmap(nullptr, mapLength, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    if (map == MAP_FAILED)
+    {
+      close(descriptor);
+      throw std::runtime_error(AppendErrorCode("Failed to map stats segment: " + path));
+    }
+
+    header = static_cast<Header*>(map);
+    rowArray = reinterpret_cast<Row*>(static_cast<unsigned char*>(map) + sizeof(Header));
+
+    std::memset(map, 0, mapLength);
+    std::memcpy(header->Magic, "RMPEVAL", 8);
+    header->Version = LayoutVersion;
+    header->RowCount = static_cast<uint32_t>(argRows.size());
+    header->PeriodNanoseconds = argPeriodNanoseconds;
+
+    for (size_t row = 0; row < argRows.size(); ++row)
+    {
+      const std::string_view label = argRows[row].first;
+      const size_t length = std::min(label.size(), MaxLabelSize - 1);
+      std::memcpy(rowArray[row].Label, label.data(), length);
+      sources.push_back(argRows[row].second);
+    }
+  }
+
+  void StatsSegment::Publish()
+  {
+    for (size_t row = 0; row < sources.size(); ++row)
+    {
+      const ReportData data = sources[row]->Read();
+      // Same seqlock discipline as ReportSlot::Publish, only the payload
+      // lives in shared memory where external readers run the read loop.
+      Row& slot = rowArray[row];
+      const uint64_t start = slot.Sequence.load(std::memory_order_relaxed);
+      slot.Sequence.store(start + 1, std::memory_order_relaxed); // odd: write in progress
+      std::atomic_thread_fence(std::memory_order_release);
+      slot.Data = data;
+      std::atomic_thread_fence(std::memory_order_release);
+      slot.Sequence.store(start + 2, std::memory_order_release);
+    }
+  }
+
+  StatsSegment::~StatsSegment()
+  {
+    if (map != nullptr)
+    {
+      munmap(map, mapLength);
+    }
+    if (descriptor >= 0)
+    {
+      close(descriptor);
+    }
+    // Remove the segment so a later reader cannot mistake a finished run's
+    // numbers for live data.
+    unlink(path.c_str());
+  }
+} // end namespace Evaluator
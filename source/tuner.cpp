@@ -0,0 +1,230 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <linux/sockios.h>
+#include <net/if.h>
+#include <optional>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "tuner.h"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+  [[nodiscard]] std::optional<std::string> ReadValue(const std::string& path)
+  {
+    std::ifstream stream(path);
+    if (!stream.is_open()) return std::nullopt;
+    std::string value;
+    std::getline(stream, value);
+    return value;
+  }
+
+  [[nodiscard]] bool WriteValue(const std::string& path, const std::string& value)
+  {
+    std::ofstream stream(path);
+    if (!stream.is_open()) return false;
+    stream << value;
+    stream.flush();
+    return stream.good();
+  }
+
+  // IRQ numbers whose /proc/interrupts label mentions the NIC; the same
+  // parse the NicIrqsPinned check uses to find its subjects.
+  [[nodiscard]] std::vector<int> FindNicIrqs(const std::string& nic)
+  {
+    std::vector<int> irqs;
+    std::ifstream stream("/proc/interrupts");
+    std::string line;
+    while (std::getline(stream, line))
+    {
+      if (line.find(nic) == std::string::npos) continue;
+      size_t pos = 0;
+      while (pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos]))) ++pos;
+      if (pos >= line.size() || !std::isdigit(static_cast<unsigned char>(line[pos]))) continue;
+      size_t colon = line.find(':', pos);
+      if (colon == std::string::npos) continue;
+      try { irqs.push_back(std::stoi(line.substr(pos, colon - pos))); } catch (...) {}
+    }
+    return irqs;
+  }
+} // end anonymous namespace
+
+namespace Evaluator
+{
+  SystemTuner::SystemTuner(const std::vector<CheckResult>& argResults, int argCpuCore, const std::string& argNicName)
+    : cpuCore(argCpuCore)
+    , nicName(argNicName)
+  {
+    for (const CheckResult& result : argResults)
+    {
+      if (result.status != Status::Fail)
+      {
+        continue;
+      }
+      switch (result.kind)
+      {
+        case CheckKind::CpuGovernor: TuneGovernor(); break;
+        case CheckKind::NicIrqsPinned: TuneNicIrqAffinity(); break;
+        case CheckKind::RpsDisabled: TuneRps(); break;
+        case CheckKind::TimerMigration: TuneTimerMigration(); break;
+        default: break; // no safe automatic remediation (isolation, BIOS, kernel flags)
+      }
+    }
+    // Coalescing has no check of its own; disable it whenever a NIC is under
+    // test, since even a few rx-usecs of moderation is visible at kHz rates.
+    if (!nicName.empty())
+    {
+      TuneCoalescing();
+    }
+  }
+
+  void SystemTuner::TunePath(const std::string& path, const std::string& value, const std::string& what)
+  {
+    auto previous = ReadValue(path);
+    if (!previous)
+    {
+      std::cerr << "WARN: --tune cannot read " << path << std::endl;
+      return;
+    }
+    if (!WriteValue(path, value))
+    {
+      std::cerr << "WARN: --tune cannot write " << value << " to " << path << std::endl;
+      return;
+    }
+    savedValues.push_back({path, *previous});
+    std::cout << "TUNE: " << what << ": " << *previous << " -> " << value << "\n";
+  }
+
+  void SystemTuner::TuneGovernor()
+  {
+    TunePath("/sys/devices/system/cpu/cpu" + std::to_string(cpuCore) + "/cpufreq/scaling_governor",
+      "performance", "CPU" + std::to_string(cpuCore) + " governor");
+  }
+
+  void SystemTuner::TuneNicIrqAffinity()
+  {
+    for (int irq : FindNicIrqs(nicName))
+    {
+      TunePath("/proc/irq/" + std::to_string(irq) + "/smp_affinity_list",
+        std::to_string(cpuCore), nicName + " IRQ " + std::to_string(irq) + " affinity");
+    }
+  }
+
+  void SystemTuner::TuneRps()
+  {
+    std::error_code error_code;
+    const fs::path queueDirectory = fs::path("/sys/class/net") / nicName / "queues";
+    for (auto& entry : fs::directory_iterator(queueDirectory, error_code))
+    {
+      if (!entry.is_directory()) continue;
+      if (entry.path().filename().string().rfind("rx-", 0) != 0) continue;
+      TunePath((entry.path() / "rps_cpus").string(), "0",
+        nicName + " " + entry.path().filename().string() + " rps_cpus");
+    }
+  }
+
+  void SystemTuner::TuneTimerMigration()
+  {
+    TunePath("/proc/sys/kernel/timer_migration", "0", "timer_migration");
+  }
+
+  void SystemTuner::TuneCoalescing()
+  {
+    const int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0)
+    {
+      std::cerr << "WARN: --tune cannot open an ethtool socket: " << std::strerror(errno) << std::endl;
+      return;
+    }
+    struct ifreq request = {};
+    std::snprintf(request.ifr_name, sizeof(request.ifr_name), "%s", nicName.c_str());
+    struct ethtool_coalesce coalesce = {};
+    coalesce.cmd = ETHTOOL_GCOALESCE;
+    request.ifr_data = reinterpret_cast<char*>(&coalesce);
+    if (ioctl(sock, SIOCETHTOOL, &request) != 0)
+    {
+      std::cout << "TUNE: " << nicName << " coalescing: driver does not expose it\n";
+      close(sock);
+      return;
+    }
+    if (coalesce.rx_coalesce_usecs == 0 && coalesce.use_adaptive_rx_coalesce == 0)
+    {
+      close(sock);
+      return; // already immediate
+    }
+    savedCoalesce = coalesce;
+    struct ethtool_coalesce target = coalesce;
+    target.cmd = ETHTOOL_SCOALESCE;
+    target.rx_coalesce_usecs = 0;
+    target.use_adaptive_rx_coalesce = 0;
+    request.ifr_data = reinterpret_cast<char*>(&target);
+    if (ioctl(sock, SIOCETHTOOL, &request) != 0)
+    {
+      std::cerr << "WARN: --tune cannot disable coalescing on " << nicName << ": " << std::strerror(errno) << std::endl;
+    }
+    else
+    {
+      coalesceSaved = true;
+      std::cout << "TUNE: " << nicName << " coalescing: rx-usecs " << coalesce.rx_coalesce_usecs
+                << " adaptive-rx " << coalesce.use_adaptive_rx_coalesce << " -> rx-usecs 0 adaptive-rx 0\n";
+    }
+    close(sock);
+  }
+
+  void SystemTuner::RestoreCoalescing()
+  {
+    if (!coalesceSaved)
+    {
+      return;
+    }
+    const int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0)
+    {
+      std::cerr << "WARN: --tune cannot restore coalescing on " << nicName << ": " << std::strerror(errno) << std::endl;
+      return;
+    }
+    struct ifreq request = {};
+    std::snprintf(request.ifr_name, sizeof(request.ifr_name), "%s", nicName.c_str());
+    savedCoalesce.cmd = ETHTOOL_SCOALESCE;
+    request.ifr_data = reinterpret_cast<char*>(&savedCoalesce);
+    if (ioctl(sock, SIOCETHTOOL, &request) != 0)
+    {
+      std::cerr << "WARN: --tune cannot restore coalescing on " << nicName << ": " << std::strerror(errno) << std::endl;
+    }
+    close(sock);
+  }
+
+  SystemTuner::~SystemTuner()
+  {
+    // Roll back in reverse order so interdependent writes unwind cleanly.
+    size_t restored = 0;
+    for (auto saved = savedValues.rbegin(); saved != savedValues.rend(); ++saved)
+    {
+      if (WriteValue(saved->Path, saved->Value))
+      {
+        ++restored;
+      }
+      else
+      {
+        std::cerr << "WARN: --tune cannot restore " << saved->Path << " to " << saved->Value << std::endl;
+      }
+    }
+    RestoreCoalescing();
+    if (restored > 0 || coalesceSaved)
+    {
+      std::cout << "TUNE: restored " << restored << " setting(s)"
+                << (coalesceSaved ? " and NIC coalescing" : "") << ".\n";
+    }
+  }
+} // end namespace Evaluator
@@ -0,0 +1,352 @@
+// Copyright (c) 2025 Robotic Systems Integration, Inc.
+// Licensed under the MIT License. See LICENSE file in the project root for details.
+
+#include <cstdio>
+#include <cstring>
+#include <linux/bpf.h>
+#include <linux/if_link.h>
+#include <linux/if_xdp.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "nictest.h"
+
+namespace Evaluator
+{
+  namespace
+  {
+    // UMEM geometry: one page-sized chunk per frame, a handful of frames for
+    // RX and a few for TX. A single probe frame is in flight per cycle, so
+    // this is generous; the whole area is a few hundred KB and is mlocked by
+    // the MCL_FUTURE lock taken in main().
+    constexpr uint32_t FrameSize = 2048;
+    constexpr uint32_t RxFrameCount = 32;
+    constexpr uint32_t TxFrameCount = 8;
+    constexpr uint32_t FrameCount = RxFrameCount + TxFrameCount;
+    constexpr uint32_t RingSize = 32; // entries per ring, power of two
+
+    long Bpf(int command, union bpf_attr* attributes)
+    {
+      return syscall(__NR_bpf, command, attributes, sizeof(*attributes));
+    }
+
+    // Ring index accesses go through atomic_ref because the counters live in
+    // memory shared with the kernel.
+    uint32_t LoadAcquire(uint32_t* address)
+    {
+      return std::atomic_ref<uint32_t>(*address).load(std::memory_order_acquire);
+    }
+
+    void StoreRelease(uint32_t* address, uint32_t value)
+    {
+      std::atomic_ref<uint32_t>(*address).store(value, std::memory_order_release);
+    }
+  } // end anonymous namespace
+
+  XdpNicTest::XdpNicTest(const TestParameters& argParams)
+    : params(argParams)
+  {
+    socketDescriptor = socket(AF_XDP, SOCK_RAW, 0);
+    if (socketDescriptor == -1)
+    {
+      throw std::runtime_error(AppendErrorCode("Failed to create AF_XDP socket."));
+    }
+
+    const unsigned int interfaceIndex = if_nametoindex(params.NicName.c_str());
+    if (interfaceIndex == 0)
+    {
+      throw std::runtime_error(AppendErrorCode("Failed to get interface index for NIC: " + params.NicName));
+    }
+
+    // Register the UMEM: page-aligned, zeroed, locked by mlockall in main.
+    umemLength = static_cast<size_t>(FrameCount) * FrameSize;
+    umem = mmap(nullptr, umemLength, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (umem == MAP_FAILED)
+    {
+      umem = nullptr;
+      throw std::runtime_error(AppendErrorCode("Failed to allocate UMEM."));
+    }
+
+    struct xdp_umem_reg umemRegistration = {};
+    umemRegistration.addr = reinterpret_cast<uint64_t>(umem);
+    umemRegistration.len = umemLength;
+    umemRegistration.chunk_size = FrameSize;
+    umemRegistration.headroom = 0;
+    if (setsockopt(socketDescriptor, SOL_XDP, XDP_UMEM_REG, &umemRegistration, sizeof(umemRegistration)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to register UMEM.")); }
+
+    // Size the four rings before mapping them.
+    uint32_t ringEntries = RingSize;
+    if (setsockopt(socketDescriptor, SOL_XDP, XDP_UMEM_FILL_RING, &ringEntries, sizeof(ringEntries)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to size UMEM fill ring.")); }
+    if (setsockopt(socketDescriptor, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ringEntries, sizeof(ringEntries)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to size UMEM completion ring.")); }
+    if (setsockopt(socketDescriptor, SOL_XDP, XDP_RX_RING, &ringEntries, sizeof(ringEntries)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to size RX ring.")); }
+    if (setsockopt(socketDescriptor, SOL_XDP, XDP_TX_RING, &ringEntries, sizeof(ringEntries)) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to size TX ring.")); }
+
+    struct xdp_mmap_offsets offsets = {};
+    socklen_t offsetsLength = sizeof(offsets);
+    if (getsockopt(socketDescriptor, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &offsetsLength) == -1)
+    { throw std::runtime_error(AppendErrorCode("Failed to query XDP ring offsets.")); }
+
+    auto mapRing = [this](RingView& ring, const xdp_ring_offset& offset, uint64_t pageOffset, size_t descSize)
+    {
+      ring.size = RingSize;
+      ring.mapLength = offset.desc + static_cast<size_t>(RingSize) * descSize;
+      ring.map = mmap(nullptr, ring.mapLength, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, socketDescriptor, static_cast<off_t>(pageOffset));
+      if (ring.map == MAP_FAILED)
+      {
+        ring.map = nullptr;
+        throw std::runtime_error(AppendErrorCode("Failed to map XDP ring."));
+      }
+      char* base = static_cast<char*>(ring.map);
+      ring.producer = reinterpret_cast<uint32_t*>(base + offset.producer);
+      ring.consumer = reinterpret_cast<uint32_t*>(base + offset.consumer);
+      ring.flags = reinterpret_cast<uint32_t*>(base + offset.flags);
+      ring.descriptors = base + offset.desc;
+    };
+
+    mapRing(fillRing, offsets.fr, XDP_UMEM_PGOFF_FILL_RING, sizeof(uint64_t));
+    mapRing(completionRing, offsets.cr, XDP_UMEM_PGOFF_COMPLETION_RING, sizeof(uint64_t));
+    mapRing(rxRing, offsets.rx, XDP_PGOFF_RX_RING, sizeof(struct xdp_desc));
+    mapRing(txRing, offsets.tx, XDP_PGOFF_TX_RING, sizeof(struct xdp_desc));
+
+    // Bind to queue 0, preferring zero-copy and falling back to copy mode for
+    // drivers that don't support it.
+    struct sockaddr_xdp address = {};
+    address.sxdp_family = AF_XDP;
+    address.sxdp_ifindex = interfaceIndex;
+    address.sxdp_queue_id = 0;
+    address.sxdp_flags = XDP_USE_NEED_WAKEUP | XDP_ZEROCOPY;
+    if (bind(socketDescriptor, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) == -1)
+    {
+      address.sxdp_flags = XDP_USE_NEED_WAKEUP | XDP_COPY;
+      if (bind(socketDescriptor, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) == -1)
+      { throw std::runtime_error(AppendErrorCode("Failed to bind AF_XDP socket (zero-copy and copy mode).")); }
+    }
+
+    // Prebuild the probe frame into every TX UMEM slot; Send() then only
+    // publishes a descriptor.
+    for (uint32_t frame = 0; frame < TxFrameCount; ++frame)
+    {
+      unsigned char* slot = static_cast<unsigned char*>(umem)
+        + static_cast<size_t>(RxFrameCount + frame) * FrameSize;
+      frameLength = BuildProbeFrame(slot, params.Datagrams);
+    }
+
+    // Give the kernel every RX frame via the fill ring.
+    {
+      uint64_t* descriptors = static_cast<uint64_t*>(fillRing.descriptors);
+      uint32_t producerIndex = LoadAcquire(fillRing.producer);
+      for (uint32_t frame = 0; frame < RxFrameCount; ++frame)
+      {
+        descriptors[(producerIndex + frame) & (fillRing.size - 1)] = static_cast<uint64_t>(frame) * FrameSize;
+      }
+      StoreRelease(fillRing.producer, producerIndex + RxFrameCount);
+    }
+
+    // XSKMAP with a single slot for queue 0.
+    {
+      union bpf_attr attributes = {};
+      attributes.map_type = BPF_MAP_TYPE_XSKMAP;
+      attributes.key_size = sizeof(uint32_t);
+      attributes.value_size = sizeof(uint32_t);
+      attributes.max_entries = 1;
+      mapDescriptor = static_cast<int>(Bpf(BPF_MAP_CREATE, &attributes));
+      if (mapDescriptor == -1)
+      { throw std::runtime_error(AppendErrorCode("Failed to create XSKMAP.")); }
+    }
+    {
+      uint32_t key = 0;
+      uint32_t value = static_cast<uint32_t>(socketDescriptor);
+      union bpf_attr attributes = {};
+      attributes.map_fd = static_cast<uint32_t>(mapDescriptor);
+      attributes.key = reinterpret_cast<uint64_t>(&key);
+      attributes.value = reinterpret_cast<uint64_t>(&value);
+      if (Bpf(BPF_MAP_UPDATE_ELEM, &attributes) == -1)
+      { throw std::runtime_error(AppendErrorCode("Failed to insert socket into XSKMAP.")); }
+    }
+
+    // Minimal redirect program, hand-assembled so no libbpf is required:
+    //   return bpf_redirect_map(&xskMap, 0, XDP_PASS);
+    {
+      struct bpf_insn instructions[] = {
+        { BPF_LD | BPF_IMM | BPF_DW, 1, BPF_PSEUDO_MAP_FD, 0, mapDescriptor }, // r1 = &xskMap
+        { 0, 0, 0, 0, 0 },                                                     // (upper half of map address)
+        { BPF_ALU64 | BPF_MOV | BPF_K, 2, 0, 0, 0 },                           // r2 = 0 (queue key)
+        { BPF_ALU64 | BPF_MOV | BPF_K, 3, 0, 0, XDP_PASS },                    // r3 = XDP_PASS (miss action)
+        { BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map },
+        { BPF_JMP | BPF_EXIT, 0, 0, 0, 0 },
+      };
+      char verifierLog[1024] = {};
+      union bpf_attr attributes = {};
+      attributes.prog_type = BPF_PROG_TYPE_XDP;
+      attributes.insns = reinterpret_cast<uint64_t>(instructions);
+      attributes.insn_cnt = sizeof(instructions) / sizeof(instructions[0]);
+      attributes.license = reinterpret_cast<uint64_t>("MIT");
+      attributes.log_buf = reinterpret_cast<uint64_t>(verifierLog);
+      attributes.log_size = sizeof(verifierLog);
+      attributes.log_level = 1;
+      programDescriptor = static_cast<int>(Bpf(BPF_PROG_LOAD, &attributes));
+      if (programDescriptor == -1)
+      {
+        std::string errorMessage = AppendErrorCode("Failed to load XDP redirect program.");
+        errorMessage += " Verifier: ";
+        errorMessage += verifierLog;
+        throw std::runtime_error(errorMessage);
+      }
+    }
+
+    // Attach via a bpf link so the program is detached automatically when the
+    // last descriptor closes, even if we crash.
+    {
+      union bpf_attr attributes = {};
+      attributes.link_create.prog_fd = static_cast<uint32_t>(programDescriptor);
+      attributes.link_create.target_ifindex = interfaceIndex;
+      attributes.link_create.attach_type = BPF_XDP;
+      linkDescriptor = static_cast<int>(Bpf(BPF_LINK_CREATE, &attributes));
+      if (linkDescriptor == -1)
+      { throw std::runtime_error(AppendErrorCode("Failed to attach XDP program to interface.")); }
+    }
+  }
+
+  void XdpNicTest::DrainCompletions()
+  {
+    uint32_t consumerIndex = LoadAcquire(completionRing.consumer);
+    const uint32_t producerIndex = LoadAcquire(completionRing.producer);
+    const uint32_t completed = producerIndex - consumerIndex;
+    if (completed > 0)
+    {
+      StoreRelease(completionRing.consumer, producerIndex);
+      outstandingTx -= completed;
+    }
+  }
+
+  void XdpNicTest::Send()
+  {
+    // Same lock-free rendezvous as the raw backend: wait for the receiver to
+    // be parked on the socket before putting the frame on the wire.
+    {
+      const uint64_t currentSend = sendIteration.load(std::memory_order_relaxed);
+      if (!SpinWaitAbove(receiveIteration, currentSend, SocketTimeout))
+      {
+        char buffer[128] = {};
+        std::snprintf(buffer, sizeof(buffer), "Timed out waiting for receiver to be ready. sendIteration=%lu, receiveIteration=%lu",
+          currentSend, receiveIteration.load(std::memory_order_relaxed));
+        throw std::runtime_error(buffer);
+      }
+    }
+
+    DrainCompletions();
+    if (outstandingTx >= TxFrameCount)
+    {
+      // Should not happen with one frame per cycle; spin the completions down
+      // rather than overwriting a frame the NIC may still be reading.
+      const uint64_t deadline = GetCurrentTime() +
+        std::chrono::duration_cast<std::chrono::nanoseconds>(SocketTimeout).count();
+      while (outstandingTx >= TxFrameCount)
+      {
+        CpuRelax();
+        DrainCompletions();
+        if (GetCurrentTime() >= deadline)
+        { throw std::runtime_error("Timed out waiting for TX completions on AF_XDP socket."); }
+      }
+    }
+
+    // The probe frame was prebuilt into the UMEM TX slots at construction.
+    const uint64_t frameAddress = static_cast<uint64_t>(RxFrameCount + nextTxFrame) * FrameSize;
+    nextTxFrame = (nextTxFrame + 1) % TxFrameCount;
+
+    // Publish the descriptor and kick the kernel only if it asked for it.
+    {
+      struct xdp_desc* descriptors = static_cast<struct xdp_desc*>(txRing.descriptors);
+      const uint32_t producerIndex = LoadAcquire(txRing.producer);
+      struct xdp_desc& descriptor = descriptors[producerIndex & (txRing.size - 1)];
+      descriptor.addr = frameAddress;
+      descriptor.len = frameLength;
+      descriptor.options = 0;
+      StoreRelease(txRing.producer, producerIndex + 1);
+      ++outstandingTx;
+    }
+    if (LoadAcquire(txRing.flags) & XDP_RING_NEED_WAKEUP)
+    {
+      if (sendto(socketDescriptor, nullptr, 0, MSG_DONTWAIT, nullptr, 0) == -1 &&
+          errno != EAGAIN && errno != EBUSY && errno != ENOBUFS)
+      { throw std::runtime_error(AppendErrorCode("Failed to kick AF_XDP TX ring.")); }
+    }
+
+    sendIteration.fetch_add(1, std::memory_order_release);
+  }
+
+  bool XdpNicTest::Receive()
+  {
+    receiveIteration.fetch_add(1, std::memory_order_release);
+
+    constexpr int timeoutMs = 1000;
+    pollfd pollFd = { .fd = socketDescriptor, .events = POLLIN, .revents = 0 };
+    int ready = poll(&pollFd, 1, timeoutMs);
+    if (ready < 0)
+    { throw std::runtime_error(AppendErrorCode("There was an error during frame polling on AF_XDP socket.")); }
+    if (ready == 0)
+    {
+      return false;
+    }
+
+    // Consume every descriptor the kernel produced and hand the frames
+    // straight back through the fill ring.
+    struct xdp_desc* rxDescriptors = static_cast<struct xdp_desc*>(rxRing.descriptors);
+    uint64_t* fillDescriptors = static_cast<uint64_t*>(fillRing.descriptors);
+    uint32_t rxConsumer = LoadAcquire(rxRing.consumer);
+    const uint32_t rxProducer = LoadAcquire(rxRing.producer);
+    uint32_t fillProducer = LoadAcquire(fillRing.producer);
+    uint32_t received = 0;
+    while (rxConsumer != rxProducer)
+    {
+      const struct xdp_desc& descriptor = rxDescriptors[rxConsumer & (rxRing.size - 1)];
+      const uint64_t frameAddress = descriptor.addr & ~(static_cast<uint64_t>(FrameSize) - 1);
+      fillDescriptors[fillProducer & (fillRing.size - 1)] = frameAddress;
+      ++fillProducer;
+      ++rxConsumer;
+      ++received;
+    }
+    if (received > 0)
+    {
+      StoreRelease(rxRing.consumer, rxConsumer);
+      StoreRelease(fillRing.producer, fillProducer);
+    }
+    return received > 0;
+  }
+
+  XdpNicTest::~XdpNicTest()
+  {
+    for (RingView* ring : { &fillRing, &completionRing, &rxRing, &txRing })
+    {
+      if (ring->map != nullptr)
+      {
+        munmap(ring->map, ring->mapLength);
+        ring->map = nullptr;
+      }
+    }
+    if (umem != nullptr)
+    {
+      munmap(umem, umemLength);
+      umem = nullptr;
+    }
+    for (int* descriptor : { &linkDescriptor, &programDescriptor, &mapDescriptor, &socketDescriptor })
+    {
+      if (*descriptor >= 0)
+      {
+        close(*descriptor);
+        *descriptor = -1;
+      }
+    }
+  }
+} // end namespace Evaluator